@@ -12,6 +12,9 @@ enum Preset {
 # Supported CAD formats
 const SUPPORTED_EXTENSIONS = ["step", "stp", "iges", "igs", "brep", "stl"]
 
+# Project-local tessellation cache shared by all reimports
+const TESSELLATION_CACHE_DIR = "res://.godot/ocgd_tessellation_cache"
+
 func _get_importer_name() -> String:
 	return "OpenCASCADE.gd-importer"
 
@@ -155,6 +158,37 @@ func _get_import_options(path: String, preset_index: int) -> Array[Dictionary]:
 		"default_value": true
 	})
 
+	options.append({
+		"name": "mesh/vertex_merge_tolerance",
+		"default_value": 1e-6,
+		"property_hint": PROPERTY_HINT_RANGE,
+		"hint_string": "1e-9,1.0,1e-9"
+	})
+
+	options.append({
+		"name": "mesh/merge_crease_angle",
+		"default_value": PI,
+		"property_hint": PROPERTY_HINT_RANGE,
+		"hint_string": "0.0,3.14159,0.01"
+	})
+
+	options.append({
+		"name": "mesh/use_tessellation_cache",
+		"default_value": true
+	})
+
+	options.append({
+		"name": "mesh/batch_by_color",
+		"default_value": false
+	})
+
+	options.append({
+		"name": "mesh/lod_levels",
+		"default_value": 0,
+		"property_hint": PROPERTY_HINT_RANGE,
+		"hint_string": "0,6,1"
+	})
+
 	# Geometry options
 	options.append({
 		"name": "geometry/repair_level",
@@ -224,12 +258,14 @@ func _apply_preset_defaults(options: Array[Dictionary], preset_index: int) -> vo
 			_set_option_value(options, "mesh/angular_deflection", 0.1)
 			_set_option_value(options, "mesh/include_normals", true)
 			_set_option_value(options, "mesh/include_uvs", true)
+			_set_option_value(options, "mesh/lod_levels", 3)
 			_set_option_value(options, "geometry/repair_level", 2)
 
 		Preset.PERFORMANCE:
 			_set_option_value(options, "mesh/linear_deflection", 0.5)
 			_set_option_value(options, "mesh/angular_deflection", 1.0)
 			_set_option_value(options, "mesh/parallel_processing", true)
+			_set_option_value(options, "mesh/lod_levels", 2)
 			_set_option_value(options, "metadata/read_colors", false)
 			_set_option_value(options, "metadata/read_materials", false)
 			_set_option_value(options, "geometry/repair_level", 0)
@@ -303,7 +339,12 @@ func _import(source_file: String, save_path: String, options: Dictionary,
 
 	# Generate meshes if requested
 	if options.get("mesh/generate_mesh", true):
-		_generate_meshes(cad_resource, options, gen_files, save_path)
+		# Per-face colors let the builder merge faces into one surface per color
+		var face_colors: Array = []
+		if options.get("mesh/batch_by_color", false) and options.get("metadata/read_colors", true):
+			for shape in shapes:
+				face_colors.append(importer.get_face_colors(shape))
+		_generate_meshes(cad_resource, options, gen_files, save_path, face_colors)
 
 	# Perform analysis if requested
 	if options.get("analysis/compute_properties", false):
@@ -356,59 +397,68 @@ func _configure_importer(importer: ocgd_CADFileImporter, options: Dictionary) ->
 	importer.set_fix_geometry(options.get("geometry/repair_level", 1) > 0)
 
 func _generate_meshes(cad_resource: CADResource, options: Dictionary,
-					 gen_files: Array[String], save_path: String) -> void:
-	var mesh_generator = ocgd_BRepMesh_IncrementalMesh.new()
-	var mesh_extractor = ocgd_MeshDataExtractor.new()
-
-	# Configure mesh extractor
-	mesh_extractor.set_include_normals(options.get("mesh/include_normals", true))
-	mesh_extractor.set_include_uvs(options.get("mesh/include_uvs", false))
-	mesh_extractor.set_merge_vertices(options.get("mesh/merge_vertices", true))
-
+					 gen_files: Array[String], save_path: String, face_colors: Array = []) -> void:
 	var meshes: Array[ArrayMesh] = []
 	var materials: Array[Material] = []
 
+	var linear_deflection = options.get("mesh/linear_deflection", 0.1)
+	var angular_deflection = options.get("mesh/angular_deflection", 0.5)
+	var relative_deflection = options.get("mesh/relative_deflection", false)
+
+	# Meshing, extraction and ArrayMesh assembly all happen natively in the builder
+	var mesh_builder = ocgd_ArrayMeshBuilder.new()
+	mesh_builder.set_linear_deflection(linear_deflection)
+	mesh_builder.set_angular_deflection(angular_deflection)
+	mesh_builder.set_relative_deflection(relative_deflection)
+	mesh_builder.set_include_normals(options.get("mesh/include_normals", true))
+	mesh_builder.set_include_uvs(options.get("mesh/include_uvs", false))
+	mesh_builder.set_merge_vertices(options.get("mesh/merge_vertices", true))
+	mesh_builder.set_vertex_merge_tolerance(options.get("mesh/vertex_merge_tolerance", 1e-6))
+	mesh_builder.set_merge_crease_angle(options.get("mesh/merge_crease_angle", PI))
+	mesh_builder.set_parallel_processing(options.get("mesh/parallel_processing", true))
+	mesh_builder.set_lod_count(options.get("mesh/lod_levels", 0))
+
+	# Meshes are cached by shape content and meshing options, so reimports that only
+	# change unrelated options skip triangulation and extraction entirely
+	var tessellation_cache: ocgd_TessellationCache = null
+	var cache_parameters = {
+		"include_normals": options.get("mesh/include_normals", true),
+		"include_uvs": options.get("mesh/include_uvs", false),
+		"merge_vertices": options.get("mesh/merge_vertices", true),
+		"vertex_merge_tolerance": mesh_builder.get_vertex_merge_tolerance(),
+		"merge_crease_angle": mesh_builder.get_merge_crease_angle(),
+		"lod_levels": mesh_builder.get_lod_count(),
+		"lod_deflection_factor": mesh_builder.get_lod_deflection_factor()
+	}
+	if options.get("mesh/use_tessellation_cache", true):
+		tessellation_cache = ocgd_TessellationCache.new()
+		tessellation_cache.set_cache_directory(TESSELLATION_CACHE_DIR)
+
 	for i in range(cad_resource.shapes.size()):
 		var shape = cad_resource.shapes[i]
 
-		# Generate triangulation
-		mesh_generator.init_with_shape(
-			shape,
-			options.get("mesh/linear_deflection", 0.1),
-			options.get("mesh/relative_deflection", false),
-			options.get("mesh/angular_deflection", 0.5),
-			options.get("mesh/parallel_processing", true)
-		)
-		mesh_generator.perform()
-		
-		# TODO: Make this debugging step optional...
-		var debug_info = mesh_extractor.get_detailed_triangulation_info(shape)
-		for face_info in debug_info["faces"]:
-			if not face_info["is_valid"]:
-				print("Face ", face_info["face_index"], " has issues: ", face_info["error"])
-				print("Nodes: ", face_info["node_count"], " Triangles: ", face_info["triangle_count"])
-				print("Array bounds - Nodes: [", face_info["nodes_lower"], ",", face_info["nodes_upper"], "]")
-
-		# Extract mesh data
-		var mesh_data = mesh_extractor.extract_mesh_data(shape)
-		if mesh_data.is_empty():
+		var array_mesh: ArrayMesh = null
+		if i < face_colors.size():
+			# Batched meshes hold several surfaces and are not cached
+			array_mesh = mesh_builder.build_batched(shape, face_colors[i])
+		elif tessellation_cache:
+			var cache_key = tessellation_cache.compute_key(shape, linear_deflection, angular_deflection,
+				relative_deflection, cache_parameters)
+			var mesh_data = {}
+			if not cache_key.is_empty():
+				mesh_data = tessellation_cache.load_mesh_data(cache_key)
+			if mesh_data.is_empty():
+				mesh_data = mesh_builder.build_mesh_data(shape)
+				if not mesh_data.is_empty() and not cache_key.is_empty():
+					tessellation_cache.store_mesh_data(cache_key, mesh_data)
+			if not mesh_data.is_empty():
+				array_mesh = mesh_builder.build_from_mesh_data(mesh_data)
+		else:
+			array_mesh = mesh_builder.build(shape)
+
+		if array_mesh == null:
 			continue
 
-		# Create Godot mesh
-		var array_mesh = ArrayMesh.new()
-		var arrays = []
-		arrays.resize(Mesh.ARRAY_MAX)
-
-		arrays[Mesh.ARRAY_VERTEX] = mesh_data.get("vertices", PackedVector3Array())
-		arrays[Mesh.ARRAY_INDEX] = mesh_data.get("triangles", PackedInt32Array())
-
-		if mesh_data.has("normals"):
-			arrays[Mesh.ARRAY_NORMAL] = mesh_data["normals"]
-
-		if mesh_data.has("uvs"):
-			arrays[Mesh.ARRAY_TEX_UV] = mesh_data["uvs"]
-
-		array_mesh.add_surface_from_arrays(Mesh.PRIMITIVE_TRIANGLES, arrays)
 		meshes.append(array_mesh)
 
 		# Create material if available
@@ -421,6 +471,9 @@ func _generate_meshes(cad_resource: CADResource, options: Dictionary,
 			ResourceSaver.save(array_mesh, mesh_path)
 			gen_files.append(mesh_path)
 
+	if tessellation_cache:
+		tessellation_cache.flush()
+
 	cad_resource.meshes = meshes
 	cad_resource.mesh_materials = materials
 
@@ -0,0 +1,48 @@
+@tool
+extends EditorScript
+
+# Scaling benchmark for ocgd_MeshDataExtractor vertex welding.
+# Builds a grid of unshared quads (4 vertices each, like per-face tessellations)
+# and times merge_mesh_data for vertex counts from 10k to 5M.
+
+const VERTEX_COUNTS = [10000, 50000, 100000, 500000, 1000000, 5000000]
+
+
+func _run() -> void:
+	var extractor = ocgd_MeshDataExtractor.new()
+	extractor.set_vertex_merge_tolerance(1e-4)
+	for vertex_count in VERTEX_COUNTS:
+		var mesh_data = _build_quad_grid(vertex_count)
+		var t1 = Time.get_ticks_usec()
+		var merged = extractor.merge_mesh_data(mesh_data)
+		var elapsed_ms = (Time.get_ticks_usec() - t1) / 1000.0
+		print("merge_mesh_data with " + str(mesh_data["vertices"].size()) + " vertices took " + str(elapsed_ms) + "ms and returned " + str(merged["vertices"].size()) + " vertices")
+
+
+func _build_quad_grid(vertex_count: int) -> Dictionary:
+	var side = int(sqrt(vertex_count / 4.0))
+	var vertices = PackedVector3Array()
+	var normals = PackedVector3Array()
+	var triangles = PackedInt32Array()
+	vertices.resize(side * side * 4)
+	normals.resize(side * side * 4)
+	triangles.resize(side * side * 6)
+	var v = 0
+	var t = 0
+	for i in range(side):
+		for j in range(side):
+			vertices[v] = Vector3(i, j, 0)
+			vertices[v + 1] = Vector3(i + 1, j, 0)
+			vertices[v + 2] = Vector3(i + 1, j + 1, 0)
+			vertices[v + 3] = Vector3(i, j + 1, 0)
+			for k in range(4):
+				normals[v + k] = Vector3(0, 0, 1)
+			triangles[t] = v
+			triangles[t + 1] = v + 2
+			triangles[t + 2] = v + 1
+			triangles[t + 3] = v
+			triangles[t + 4] = v + 3
+			triangles[t + 5] = v + 2
+			v += 4
+			t += 6
+	return {"vertices": vertices, "triangles": triangles, "normals": normals}
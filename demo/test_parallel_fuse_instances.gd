@@ -0,0 +1,42 @@
+@tool
+extends EditorScript
+
+# Check for ocgd_BooleanOperations balanced-tree unions with run_parallel enabled.
+# Fuses located copies of one box, which all share the same TShape, with the pairs of
+# each tree level running concurrently. Every run must give the same valid solid.
+
+const INSTANCE_COUNT = 16
+const BOX_SIZE = 2.0
+const SPACING = 1.5
+const RUNS = 5
+
+
+func _run() -> void:
+	var box = ocgd_PrimitiveShapes.new().create_box(BOX_SIZE, BOX_SIZE, BOX_SIZE)
+	var instances = []
+	for i in range(INSTANCE_COUNT):
+		instances.append(box.moved(Vector3(i * SPACING, 0, 0)))
+
+	var operations = ocgd_BooleanOperations.new()
+	operations.set_multi_shape_strategy(ocgd_BooleanOperations.MULTI_SHAPE_BALANCED_TREE)
+	operations.set_run_parallel(true)
+
+	var analyzer = ocgd_ShapeAnalyzer.new()
+	var expected_volume = (SPACING * (INSTANCE_COUNT - 1) + BOX_SIZE) * BOX_SIZE * BOX_SIZE
+	var failures = 0
+	for run in range(RUNS):
+		var fused = operations.union_multiple(instances)
+		if fused == null:
+			push_error("Run " + str(run) + ": union_multiple failed: " + operations.get_last_error())
+			failures += 1
+			continue
+		var volume = analyzer.get_volume(fused)
+		if abs(volume - expected_volume) > 1e-6 * expected_volume or not analyzer.is_valid_solid(fused):
+			push_error("Run " + str(run) + ": got volume " + str(volume) + ", expected a valid solid of " + str(expected_volume))
+			failures += 1
+
+	if abs(analyzer.get_volume(box) - BOX_SIZE * BOX_SIZE * BOX_SIZE) > 1e-9 or not analyzer.is_valid_solid(box):
+		push_error("The shared input box was modified")
+		failures += 1
+
+	print("Parallel fuse of " + str(INSTANCE_COUNT) + " instances: " + ("passed" if failures == 0 else str(failures) + " failures"))
@@ -8,7 +8,10 @@
 
 #include "ocgd_AdvancedMeshExporter.hxx"
 #include "ocgd_EnhancedNormals.hxx"
+#include "ocgd_FileAccessSink.hxx"
+#include "ocgd_MeshFileParser.hxx"
 
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
@@ -29,7 +32,137 @@
 #include <opencascade/gp_Ax3.hxx>
 #include <opencascade/Message_ProgressRange.hxx>
 
-#include <fstream>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Upper bound of one text line: six floats or three "a//b" index pairs plus separators
+const int64_t MESH_TEXT_LINE_MAX_SIZE = 256;
+const int64_t FLOAT_TEXT_MAX_SIZE = 32;
+
+// Binary PLY records: float x, y, z (+ nx, ny, nz) per vertex, uchar count + 3 int per face
+const int64_t PLY_BINARY_VERTEX_MAX_SIZE = 24;
+const int64_t PLY_BINARY_FACE_SIZE = 13;
+
+// Triangulated face prepared for streaming export
+struct MeshExportFace {
+    TopoDS_Face face;
+    TopLoc_Location location;
+    Handle(Poly_Triangulation) triangulation;
+    bool reversed = false;
+};
+
+// Collect all triangulated faces of a shape, count their nodes and return the triangle count
+int64_t collect_export_faces(const TopoDS_Shape& shape, std::vector<MeshExportFace>& faces, int64_t& vertex_count) {
+    int64_t triangle_count = 0;
+    vertex_count = 0;
+    for (TopExp_Explorer face_explorer(shape, TopAbs_FACE); face_explorer.More(); face_explorer.Next()) {
+        MeshExportFace export_face;
+        export_face.face = TopoDS::Face(face_explorer.Current());
+        export_face.triangulation = BRep_Tool::Triangulation(export_face.face, export_face.location);
+        if (export_face.triangulation.IsNull() || export_face.triangulation->NbNodes() == 0
+            || export_face.triangulation->NbTriangles() == 0) {
+            continue;
+        }
+        export_face.reversed = export_face.face.Orientation() == TopAbs_REVERSED;
+        vertex_count += export_face.triangulation->NbNodes();
+        triangle_count += export_face.triangulation->NbTriangles();
+        faces.push_back(export_face);
+    }
+    return triangle_count;
+}
+
+// Per-node normals of one face with the face location applied; (0, 0, 1) if they can't be computed
+PackedVector3Array get_export_normals(const MeshExportFace& face) {
+    const Standard_Integer nb_nodes = face.triangulation->NbNodes();
+    PackedVector3Array normals = ocgd_EnhancedNormals::extract_normals_as_vector3_array(face.face, face.triangulation, face.location);
+    if (normals.size() != nb_nodes) {
+        normals.resize(nb_nodes);
+        normals.fill(Vector3(0, 0, 1));
+    }
+    return normals;
+}
+
+// Same conversion as ocgd_AdvancedMeshExporter::transform_mesh_data, for a single vector
+inline void convert_export_vector(ocgd_AdvancedMeshExporter::CoordinateSystem system, float* v, bool is_normal) {
+    switch (system) {
+        case ocgd_AdvancedMeshExporter::COORD_UNITY:
+            std::swap(v[1], v[2]);
+            v[0] = -v[0];
+            break;
+        case ocgd_AdvancedMeshExporter::COORD_UNREAL:
+            if (!is_normal) {
+                v[0] *= 100.0f;
+                v[1] *= 100.0f;
+                v[2] *= 100.0f;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+// Fetch node index (1-based) of a face as position (+ normal) in output coordinates,
+// returns the number of floats written to values
+inline int get_export_vertex(const MeshExportFace& face, const PackedVector3Array& normals, Standard_Integer index,
+                             bool with_normals, ocgd_AdvancedMeshExporter::CoordinateSystem system, float* values) {
+    gp_Pnt point = face.triangulation->Node(index);
+    if (!face.location.IsIdentity()) {
+        point.Transform(face.location.Transformation());
+    }
+    values[0] = static_cast<float>(point.X());
+    values[1] = static_cast<float>(point.Y());
+    values[2] = static_cast<float>(point.Z());
+    convert_export_vector(system, values, false);
+    if (!with_normals) {
+        return 3;
+    }
+
+    const Vector3& normal = normals[index - 1];
+    values[3] = normal.x;
+    values[4] = normal.y;
+    values[5] = normal.z;
+    convert_export_vector(system, values + 3, true);
+    return 6;
+}
+
+// Fetch the node indices (1-based) of a triangle in counter-clockwise outward winding
+inline void get_export_triangle(const MeshExportFace& face, Standard_Integer index, Standard_Integer* nodes) {
+    face.triangulation->Triangle(index).Get(nodes[0], nodes[1], nodes[2]);
+    if (face.reversed) {
+        std::swap(nodes[1], nodes[2]);
+    }
+}
+
+// Shortest text that reads back as the same float
+inline char* put_float_text(char* dst, float value) {
+#if defined(__cpp_lib_to_chars)
+    return std::to_chars(dst, dst + FLOAT_TEXT_MAX_SIZE, value).ptr;
+#else
+    return dst + std::snprintf(dst, FLOAT_TEXT_MAX_SIZE, "%.9g", value);
+#endif
+}
+
+inline char* put_int_text(char* dst, int64_t value) {
+    return std::to_chars(dst, dst + FLOAT_TEXT_MAX_SIZE, value).ptr;
+}
+
+inline uint8_t* put_int32_le(uint8_t* dst, int32_t value) {
+    const uint32_t bits = static_cast<uint32_t>(value);
+    dst[0] = static_cast<uint8_t>(bits);
+    dst[1] = static_cast<uint8_t>(bits >> 8);
+    dst[2] = static_cast<uint8_t>(bits >> 16);
+    dst[3] = static_cast<uint8_t>(bits >> 24);
+    return dst + 4;
+}
+
+} // namespace
 
 void ocgd_AdvancedMeshExporter::_bind_methods() {
     // Enums
@@ -37,6 +170,7 @@ void ocgd_AdvancedMeshExporter::_bind_methods() {
     BIND_ENUM_CONSTANT(FORMAT_OBJ);
     BIND_ENUM_CONSTANT(FORMAT_STL_ASCII);
     BIND_ENUM_CONSTANT(FORMAT_STL_BINARY);
+    BIND_ENUM_CONSTANT(FORMAT_PLY_BINARY);
 
     BIND_ENUM_CONSTANT(COLOR_NONE);
     BIND_ENUM_CONSTANT(COLOR_PER_SHAPE);
@@ -303,6 +437,7 @@ bool ocgd_AdvancedMeshExporter::export_shape(const Ref<ocgd_TopoDS_Shape>& shape
 
         switch (_format) {
             case FORMAT_PLY:
+            case FORMAT_PLY_BINARY:
                 return export_ply(occt_shape, file_path);
             case FORMAT_OBJ:
                 return export_obj(occt_shape, file_path);
@@ -689,6 +824,9 @@ int ocgd_AdvancedMeshExporter::estimate_file_size(const Ref<ocgd_TopoDS_Shape>&
         case FORMAT_PLY:
             // PLY: ~24 bytes per vertex + ~12 bytes per triangle + header
             return vertex_count * 24 + triangle_count * 12 + 1024;
+        case FORMAT_PLY_BINARY:
+            // Binary PLY: 12 bytes per vertex (+12 with normals) + 13 bytes per triangle + header
+            return vertex_count * (_export_normals ? 24 : 12) + triangle_count * 13 + 512;
         case FORMAT_OBJ:
             // OBJ: ~30 bytes per vertex + ~15 bytes per triangle (text format)
             return vertex_count * 30 + triangle_count * 15 + 512;
@@ -708,6 +846,7 @@ PackedStringArray ocgd_AdvancedMeshExporter::get_supported_extensions() const {
 
     switch (_format) {
         case FORMAT_PLY:
+        case FORMAT_PLY_BINARY:
             extensions.append("ply");
             break;
         case FORMAT_OBJ:
@@ -727,12 +866,13 @@ Dictionary ocgd_AdvancedMeshExporter::get_format_capabilities(ExportFormat forma
 
     switch (format) {
         case FORMAT_PLY:
+        case FORMAT_PLY_BINARY:
             caps["supports_colors"] = true;
             caps["supports_normals"] = true;
             caps["supports_textures"] = true;
             caps["supports_materials"] = false;
-            caps["binary_format"] = true;
-            caps["text_format"] = true;
+            caps["binary_format"] = (format == FORMAT_PLY_BINARY);
+            caps["text_format"] = (format == FORMAT_PLY);
             break;
         case FORMAT_OBJ:
             caps["supports_colors"] = false;
@@ -793,14 +933,17 @@ bool ocgd_AdvancedMeshExporter::triangulate_shape(const Ref<ocgd_TopoDS_Shape>&
             return false;
         }
 
-        BRepMesh_IncrementalMesh mesh(occt_shape, _linear_deflection, _relative_deflection, _angular_deflection);
-        mesh.SetParallelDefault(_parallel_processing);
-        mesh.Perform();
+        // Imported meshes (e.g. mesh-only STL) have no surfaces to mesh; keep their triangulation
+        if (!ocgd_MeshFileParser::is_mesh_only(occt_shape)) {
+            BRepMesh_IncrementalMesh mesh(occt_shape, _linear_deflection, _relative_deflection, _angular_deflection);
+            mesh.SetParallelDefault(_parallel_processing);
+            mesh.Perform();
 
-        if (!mesh.IsDone()) {
-            UtilityFunctions::printerr("AdvancedMeshExporter: Triangulation operation failed");
-            set_error("Triangulation operation failed");
-            return false;
+            if (!mesh.IsDone()) {
+                UtilityFunctions::printerr("AdvancedMeshExporter: Triangulation operation failed");
+                set_error("Triangulation operation failed");
+                return false;
+            }
         }
 
         // Compute normals if exporting normals is enabled and compute_normals is true
@@ -1047,64 +1190,124 @@ void ocgd_AdvancedMeshExporter::transform_mesh_data(PackedVector3Array& vertices
 
 bool ocgd_AdvancedMeshExporter::export_ply(const TopoDS_Shape& shape, const String& file_path) {
     try {
-        // For now, use a simple PLY export implementation
-        // This could be enhanced to use RWPly_CafWriter for full feature support
-
-        Dictionary mesh_data = extract_mesh_data(Ref<ocgd_TopoDS_Shape>());
-        if (mesh_data.is_empty()) {
-            set_error("Failed to extract mesh data for PLY export");
+        std::vector<MeshExportFace> faces;
+        int64_t vertex_count = 0;
+        const int64_t triangle_count = collect_export_faces(shape, faces, vertex_count);
+        if (triangle_count == 0) {
+            set_error("Shape has no triangulation data to export as PLY");
+            return false;
+        }
+        if (vertex_count > INT32_MAX) {
+            set_error("Too many vertices for PLY int vertex indices");
             return false;
         }
 
-        PackedVector3Array vertices = mesh_data.get("vertices", PackedVector3Array());
-        PackedInt32Array indices = mesh_data.get("indices", PackedInt32Array());
-        PackedVector3Array normals = mesh_data.get("normals", PackedVector3Array());
-
-        std::ofstream file(file_path.utf8().get_data());
-        if (!file.is_open()) {
+        Ref<FileAccess> file = FileAccess::open(file_path, FileAccess::WRITE);
+        if (file.is_null()) {
             set_error("Failed to open PLY file for writing");
             return false;
         }
 
-        // Write PLY header
-        file << "ply\n";
-        file << "format ascii 1.0\n";
-        file << "element vertex " << vertices.size() << "\n";
-        file << "property float x\n";
-        file << "property float y\n";
-        file << "property float z\n";
+        const bool binary = (_format == FORMAT_PLY_BINARY);
+
+        // Both element counts are known from the collected faces, so the header goes out first
+        // and the body is streamed face by face
+        std::string header = "ply\n";
+        header += binary ? "format binary_little_endian 1.0\n" : "format ascii 1.0\n";
+        header += "comment Exported by OpenCASCADE.gd\n";
+        header += "element vertex " + std::to_string(vertex_count) + "\n";
+        header += "property float x\nproperty float y\nproperty float z\n";
+        if (_export_normals) {
+            header += "property float nx\nproperty float ny\nproperty float nz\n";
+        }
+        header += "element face " + std::to_string(triangle_count) + "\n";
+        header += "property list uchar int vertex_indices\n";
+        header += "end_header\n";
+
+        ocgd_FileAccessSink sink(file);
+        sink.write(header.data(), static_cast<int64_t>(header.size()));
+
+        const int total_steps = static_cast<int>(faces.size()) * 2;
+        PackedVector3Array face_normals;
+        float values[6];
+
+        for (size_t f = 0; f < faces.size(); f++) {
+            const MeshExportFace& face = faces[f];
+            const Standard_Integer nb_nodes = face.triangulation->NbNodes();
+            if (_export_normals) {
+                face_normals = get_export_normals(face);
+            }
 
-        if (normals.size() > 0) {
-            file << "property float nx\n";
-            file << "property float ny\n";
-            file << "property float nz\n";
+            for (Standard_Integer i = 1; i <= nb_nodes; i++) {
+                const int value_count = get_export_vertex(face, face_normals, i, _export_normals, _coordinate_system, values);
+
+                if (binary) {
+                    uint8_t* dst = sink.reserve(PLY_BINARY_VERTEX_MAX_SIZE);
+                    for (int k = 0; k < value_count; k++) {
+                        dst = ocgd_put_float_le(dst, values[k]);
+                    }
+                    sink.commit(value_count * 4);
+                } else {
+                    char* line = reinterpret_cast<char*>(sink.reserve(MESH_TEXT_LINE_MAX_SIZE));
+                    char* dst = line;
+                    for (int k = 0; k < value_count; k++) {
+                        if (k > 0) {
+                            *dst++ = ' ';
+                        }
+                        dst = put_float_text(dst, values[k]);
+                    }
+                    *dst++ = '\n';
+                    sink.commit(dst - line);
+                }
+            }
+            update_progress(static_cast<int>(f) + 1, total_steps);
         }
 
-        file << "element face " << (indices.size() / 3) << "\n";
-        file << "property list uchar int vertex_indices\n";
-        file << "end_header\n";
+        int64_t vertex_offset = 0;
+        Standard_Integer nodes[3];
 
-        // Write vertices
-        for (int i = 0; i < vertices.size(); i++) {
-            const Vector3& v = vertices[i];
-            file << v.x << " " << v.y << " " << v.z;
+        for (size_t f = 0; f < faces.size(); f++) {
+            const MeshExportFace& face = faces[f];
+            const Standard_Integer nb_triangles = face.triangulation->NbTriangles();
+
+            for (Standard_Integer i = 1; i <= nb_triangles; i++) {
+                get_export_triangle(face, i, nodes);
 
-            if (i < normals.size()) {
-                const Vector3& n = normals[i];
-                file << " " << n.x << " " << n.y << " " << n.z;
+                if (binary) {
+                    uint8_t* dst = sink.reserve(PLY_BINARY_FACE_SIZE);
+                    *dst++ = 3;
+                    for (int k = 0; k < 3; k++) {
+                        dst = put_int32_le(dst, static_cast<int32_t>(vertex_offset + nodes[k] - 1));
+                    }
+                    sink.commit(PLY_BINARY_FACE_SIZE);
+                } else {
+                    char* line = reinterpret_cast<char*>(sink.reserve(MESH_TEXT_LINE_MAX_SIZE));
+                    char* dst = line;
+                    *dst++ = '3';
+                    for (int k = 0; k < 3; k++) {
+                        *dst++ = ' ';
+                        dst = put_int_text(dst, vertex_offset + nodes[k] - 1);
+                    }
+                    *dst++ = '\n';
+                    sink.commit(dst - line);
+                }
             }
 
-            file << "\n";
+            vertex_offset += face.triangulation->NbNodes();
+            update_progress(static_cast<int>(faces.size() + f) + 1, total_steps);
         }
 
-        // Write faces
-        for (int i = 0; i < indices.size(); i += 3) {
-            file << "3 " << indices[i] << " " << indices[i+1] << " " << indices[i+2] << "\n";
-        }
+        sink.flush();
 
-        file.close();
+        if (file->get_error() != OK) {
+            set_error("Write operation failed for PLY file: " + file_path);
+            return false;
+        }
         return true;
 
+    } catch (const Standard_Failure& e) {
+        set_error(String("PLY export failed: ") + String(e.GetMessageString()));
+        return false;
     } catch (const std::exception& e) {
         set_error(String("PLY export failed: ") + String(e.what()));
         return false;
@@ -1113,51 +1316,98 @@ bool ocgd_AdvancedMeshExporter::export_ply(const TopoDS_Shape& shape, const Stri
 
 bool ocgd_AdvancedMeshExporter::export_obj(const TopoDS_Shape& shape, const String& file_path) {
     try {
-        // Simple OBJ export implementation
-        Dictionary mesh_data = extract_mesh_data(Ref<ocgd_TopoDS_Shape>());
-        if (mesh_data.is_empty()) {
-            set_error("Failed to extract mesh data for OBJ export");
+        std::vector<MeshExportFace> faces;
+        int64_t vertex_count = 0;
+        const int64_t triangle_count = collect_export_faces(shape, faces, vertex_count);
+        if (triangle_count == 0) {
+            set_error("Shape has no triangulation data to export as OBJ");
             return false;
         }
 
-        PackedVector3Array vertices = mesh_data.get("vertices", PackedVector3Array());
-        PackedInt32Array indices = mesh_data.get("indices", PackedInt32Array());
-        PackedVector3Array normals = mesh_data.get("normals", PackedVector3Array());
-
-        std::ofstream file(file_path.utf8().get_data());
-        if (!file.is_open()) {
+        Ref<FileAccess> file = FileAccess::open(file_path, FileAccess::WRITE);
+        if (file.is_null()) {
             set_error("Failed to open OBJ file for writing");
             return false;
         }
 
-        file << "# OBJ file exported from OpenCASCADE.gd\n";
+        ocgd_FileAccessSink sink(file);
+        const char header[] = "# OBJ file exported from OpenCASCADE.gd\n";
+        sink.write(header, static_cast<int64_t>(sizeof(header) - 1));
+
+        // OBJ indices are global and 1-based, so each face can be written as its own
+        // block of v/vn/f lines without knowing the totals up front
+        const int total_steps = static_cast<int>(faces.size());
+        int64_t vertex_offset = 1;
+        PackedVector3Array face_normals;
+        Standard_Integer nodes[3];
+        float values[6];
+
+        for (size_t f = 0; f < faces.size(); f++) {
+            const MeshExportFace& face = faces[f];
+            const Standard_Integer nb_nodes = face.triangulation->NbNodes();
+            const Standard_Integer nb_triangles = face.triangulation->NbTriangles();
+            if (_export_normals) {
+                face_normals = get_export_normals(face);
+            }
 
-        // Write vertices
-        for (int i = 0; i < vertices.size(); i++) {
-            const Vector3& v = vertices[i];
-            file << "v " << v.x << " " << v.y << " " << v.z << "\n";
-        }
+            for (Standard_Integer i = 1; i <= nb_nodes; i++) {
+                get_export_vertex(face, face_normals, i, _export_normals, _coordinate_system, values);
 
-        // Write normals
-        for (int i = 0; i < normals.size(); i++) {
-            const Vector3& n = normals[i];
-            file << "vn " << n.x << " " << n.y << " " << n.z << "\n";
-        }
+                char* line = reinterpret_cast<char*>(sink.reserve(MESH_TEXT_LINE_MAX_SIZE));
+                char* dst = line;
+                *dst++ = 'v';
+                for (int k = 0; k < 3; k++) {
+                    *dst++ = ' ';
+                    dst = put_float_text(dst, values[k]);
+                }
+                *dst++ = '\n';
+                if (_export_normals) {
+                    *dst++ = 'v';
+                    *dst++ = 'n';
+                    for (int k = 3; k < 6; k++) {
+                        *dst++ = ' ';
+                        dst = put_float_text(dst, values[k]);
+                    }
+                    *dst++ = '\n';
+                }
+                sink.commit(dst - line);
+            }
+
+            for (Standard_Integer i = 1; i <= nb_triangles; i++) {
+                get_export_triangle(face, i, nodes);
 
-        // Write faces
-        for (int i = 0; i < indices.size(); i += 3) {
-            if (normals.size() > 0) {
-                file << "f " << (indices[i]+1) << "//" << (indices[i]+1) << " "
-                     << (indices[i+1]+1) << "//" << (indices[i+1]+1) << " "
-                     << (indices[i+2]+1) << "//" << (indices[i+2]+1) << "\n";
-            } else {
-                file << "f " << (indices[i]+1) << " " << (indices[i+1]+1) << " " << (indices[i+2]+1) << "\n";
+                char* line = reinterpret_cast<char*>(sink.reserve(MESH_TEXT_LINE_MAX_SIZE));
+                char* dst = line;
+                *dst++ = 'f';
+                for (int k = 0; k < 3; k++) {
+                    const int64_t index = vertex_offset + nodes[k] - 1;
+                    *dst++ = ' ';
+                    dst = put_int_text(dst, index);
+                    if (_export_normals) {
+                        *dst++ = '/';
+                        *dst++ = '/';
+                        dst = put_int_text(dst, index);
+                    }
+                }
+                *dst++ = '\n';
+                sink.commit(dst - line);
             }
+
+            vertex_offset += nb_nodes;
+            update_progress(static_cast<int>(f) + 1, total_steps);
         }
 
-        file.close();
+        sink.flush();
+
+        if (file->get_error() != OK) {
+            set_error("Write operation failed for OBJ file: " + file_path);
+            return false;
+        }
         return true;
 
+    } catch (const Standard_Failure& e) {
+        set_error(String("OBJ export failed: ") + String(e.GetMessageString()));
+        return false;
     } catch (const std::exception& e) {
         set_error(String("OBJ export failed: ") + String(e.what()));
         return false;
@@ -82,7 +82,8 @@ public:
         FORMAT_PLY = 0,     ///< Stanford PLY format (supports colors, normals, textures)
         FORMAT_OBJ = 1,     ///< Wavefront OBJ format (supports materials, textures)
         FORMAT_STL_ASCII = 2,   ///< STL ASCII format (geometry only)
-        FORMAT_STL_BINARY = 3   ///< STL Binary format (geometry only)
+        FORMAT_STL_BINARY = 3,  ///< STL Binary format (geometry only)
+        FORMAT_PLY_BINARY = 4   ///< Stanford PLY binary_little_endian format
     };
 
     /**
@@ -342,12 +343,15 @@ private:
                            PackedVector3Array& normals) const;
 
     /**
-     * @brief Export to PLY format
+     * @brief Export to PLY format (ASCII or binary_little_endian, depending on the format)
+     *
+     * Streams the triangulation face by face through a chunked buffer instead of
+     * building the whole mesh in memory first.
      */
     bool export_ply(const TopoDS_Shape& shape, const String& file_path);
 
     /**
-     * @brief Export to OBJ format
+     * @brief Export to OBJ format, streamed face by face like export_ply
      */
     bool export_obj(const TopoDS_Shape& shape, const String& file_path);
 
@@ -0,0 +1,625 @@
+/**
+ * ocgd_ArrayMeshBuilder.cpp
+ *
+ * Godot GDExtension builder turning OpenCASCADE shapes directly into Godot ArrayMesh resources implementation.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_ArrayMeshBuilder.hxx"
+#include "ocgd_MeshFileParser.hxx"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/mesh.hpp>
+#include <godot_cpp/classes/standard_material3d.hpp>
+#include <godot_cpp/classes/base_material3d.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <opencascade/BRepBuilderAPI_Copy.hxx>
+#include <opencascade/BRepMesh_IncrementalMesh.hxx>
+#include <opencascade/BRepBndLib.hxx>
+#include <opencascade/Bnd_Box.hxx>
+#include <opencascade/Standard_Failure.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <tuple>
+
+using namespace godot;
+
+namespace {
+
+// Godot's per-mesh surface limit (RenderingServer::MAX_MESH_SURFACES)
+const int MAX_MESH_SURFACES = 256;
+
+const char* FACE_RANGES_META = "face_ranges";
+
+// Coarse LOD levels stop growing the angular deflection here, beyond it curved faces collapse
+const double MAX_LOD_ANGULAR_DEFLECTION = M_PI / 4.0;
+
+// Strict ordering of colors so equal colors share a surface
+struct ColorLess {
+    bool operator()(const Color& a, const Color& b) const {
+        return std::tie(a.r, a.g, a.b, a.a) < std::tie(b.r, b.g, b.b, b.a);
+    }
+};
+
+// Smooth vertex normals of a triangle list in Godot's clockwise front-face winding
+PackedVector3Array compute_vertex_normals(const PackedVector3Array& vertices, const PackedInt32Array& triangles) {
+    PackedVector3Array normals;
+    normals.resize(vertices.size());
+    normals.fill(Vector3());
+
+    const Vector3* points = vertices.ptr();
+    const int32_t* indices = triangles.ptr();
+    Vector3* accumulated = normals.ptrw();
+    for (int64_t i = 0; i + 2 < triangles.size(); i += 3) {
+        const Vector3& a = points[indices[i]];
+        // Unnormalized, so larger triangles weigh more
+        const Vector3 normal = (points[indices[i + 2]] - a).cross(points[indices[i + 1]] - a);
+        accumulated[indices[i]] += normal;
+        accumulated[indices[i + 1]] += normal;
+        accumulated[indices[i + 2]] += normal;
+    }
+
+    for (int64_t i = 0; i < normals.size(); i++) {
+        accumulated[i] = accumulated[i].length_squared() > 1e-24 ? accumulated[i].normalized() : Vector3(0, 0, 1);
+    }
+    return normals;
+}
+
+} // namespace
+
+void ocgd_ArrayMeshBuilder::_bind_methods() {
+    // Settings
+    ClassDB::bind_method(D_METHOD("set_linear_deflection", "deflection"), &ocgd_ArrayMeshBuilder::set_linear_deflection);
+    ClassDB::bind_method(D_METHOD("get_linear_deflection"), &ocgd_ArrayMeshBuilder::get_linear_deflection);
+    ClassDB::bind_method(D_METHOD("set_angular_deflection", "deflection"), &ocgd_ArrayMeshBuilder::set_angular_deflection);
+    ClassDB::bind_method(D_METHOD("get_angular_deflection"), &ocgd_ArrayMeshBuilder::get_angular_deflection);
+    ClassDB::bind_method(D_METHOD("set_relative_deflection", "relative"), &ocgd_ArrayMeshBuilder::set_relative_deflection);
+    ClassDB::bind_method(D_METHOD("get_relative_deflection"), &ocgd_ArrayMeshBuilder::get_relative_deflection);
+    ClassDB::bind_method(D_METHOD("set_include_normals", "include"), &ocgd_ArrayMeshBuilder::set_include_normals);
+    ClassDB::bind_method(D_METHOD("get_include_normals"), &ocgd_ArrayMeshBuilder::get_include_normals);
+    ClassDB::bind_method(D_METHOD("set_include_uvs", "include"), &ocgd_ArrayMeshBuilder::set_include_uvs);
+    ClassDB::bind_method(D_METHOD("get_include_uvs"), &ocgd_ArrayMeshBuilder::get_include_uvs);
+    ClassDB::bind_method(D_METHOD("set_merge_vertices", "merge"), &ocgd_ArrayMeshBuilder::set_merge_vertices);
+    ClassDB::bind_method(D_METHOD("get_merge_vertices"), &ocgd_ArrayMeshBuilder::get_merge_vertices);
+    ClassDB::bind_method(D_METHOD("set_vertex_merge_tolerance", "tolerance"), &ocgd_ArrayMeshBuilder::set_vertex_merge_tolerance);
+    ClassDB::bind_method(D_METHOD("get_vertex_merge_tolerance"), &ocgd_ArrayMeshBuilder::get_vertex_merge_tolerance);
+    ClassDB::bind_method(D_METHOD("set_merge_crease_angle", "angle"), &ocgd_ArrayMeshBuilder::set_merge_crease_angle);
+    ClassDB::bind_method(D_METHOD("get_merge_crease_angle"), &ocgd_ArrayMeshBuilder::get_merge_crease_angle);
+    ClassDB::bind_method(D_METHOD("set_parallel_processing", "parallel"), &ocgd_ArrayMeshBuilder::set_parallel_processing);
+    ClassDB::bind_method(D_METHOD("get_parallel_processing"), &ocgd_ArrayMeshBuilder::get_parallel_processing);
+    ClassDB::bind_method(D_METHOD("set_worker_count", "count"), &ocgd_ArrayMeshBuilder::set_worker_count);
+    ClassDB::bind_method(D_METHOD("get_worker_count"), &ocgd_ArrayMeshBuilder::get_worker_count);
+    ClassDB::bind_method(D_METHOD("set_lod_count", "count"), &ocgd_ArrayMeshBuilder::set_lod_count);
+    ClassDB::bind_method(D_METHOD("get_lod_count"), &ocgd_ArrayMeshBuilder::get_lod_count);
+    ClassDB::bind_method(D_METHOD("set_lod_deflection_factor", "factor"), &ocgd_ArrayMeshBuilder::set_lod_deflection_factor);
+    ClassDB::bind_method(D_METHOD("get_lod_deflection_factor"), &ocgd_ArrayMeshBuilder::get_lod_deflection_factor);
+
+    // Building
+    ClassDB::bind_method(D_METHOD("build", "shape"), &ocgd_ArrayMeshBuilder::build);
+    ClassDB::bind_method(D_METHOD("build_from_shape", "shape"), &ocgd_ArrayMeshBuilder::build_from_shape);
+    ClassDB::bind_method(D_METHOD("build_mesh_data", "shape"), &ocgd_ArrayMeshBuilder::build_mesh_data);
+    ClassDB::bind_method(D_METHOD("build_from_mesh_data", "mesh_data"), &ocgd_ArrayMeshBuilder::build_from_mesh_data);
+    ClassDB::bind_method(D_METHOD("build_batched", "shape", "face_colors"), &ocgd_ArrayMeshBuilder::build_batched, DEFVAL(PackedColorArray()));
+    ClassDB::bind_method(D_METHOD("build_batched_from_shape", "shape", "face_colors"), &ocgd_ArrayMeshBuilder::build_batched_from_shape, DEFVAL(PackedColorArray()));
+    ClassDB::bind_method(D_METHOD("get_face_index", "mesh", "surface", "triangle"), &ocgd_ArrayMeshBuilder::get_face_index);
+
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::FLOAT, "linear_deflection"), "set_linear_deflection", "get_linear_deflection");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::FLOAT, "angular_deflection"), "set_angular_deflection", "get_angular_deflection");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::BOOL, "relative_deflection"), "set_relative_deflection", "get_relative_deflection");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::BOOL, "include_normals"), "set_include_normals", "get_include_normals");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::BOOL, "include_uvs"), "set_include_uvs", "get_include_uvs");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::BOOL, "merge_vertices"), "set_merge_vertices", "get_merge_vertices");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::FLOAT, "vertex_merge_tolerance"), "set_vertex_merge_tolerance", "get_vertex_merge_tolerance");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::FLOAT, "merge_crease_angle"), "set_merge_crease_angle", "get_merge_crease_angle");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::BOOL, "parallel_processing"), "set_parallel_processing", "get_parallel_processing");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::INT, "worker_count"), "set_worker_count", "get_worker_count");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::INT, "lod_count"), "set_lod_count", "get_lod_count");
+    ClassDB::add_property("ocgd_ArrayMeshBuilder", PropertyInfo(Variant::FLOAT, "lod_deflection_factor"), "set_lod_deflection_factor", "get_lod_deflection_factor");
+}
+
+ocgd_ArrayMeshBuilder::ocgd_ArrayMeshBuilder() :
+    _linear_deflection(0.1),
+    _angular_deflection(0.5),
+    _relative_deflection(false),
+    _include_normals(true),
+    _include_uvs(false),
+    _merge_vertices(true),
+    _vertex_merge_tolerance(1e-6),
+    _merge_crease_angle(M_PI),
+    _parallel_processing(true),
+    _worker_count(0),
+    _lod_count(0),
+    _lod_deflection_factor(2.0) {
+}
+
+ocgd_ArrayMeshBuilder::~ocgd_ArrayMeshBuilder() {
+}
+
+void ocgd_ArrayMeshBuilder::set_linear_deflection(double deflection) {
+    _linear_deflection = deflection;
+}
+
+double ocgd_ArrayMeshBuilder::get_linear_deflection() const {
+    return _linear_deflection;
+}
+
+void ocgd_ArrayMeshBuilder::set_angular_deflection(double deflection) {
+    _angular_deflection = deflection;
+}
+
+double ocgd_ArrayMeshBuilder::get_angular_deflection() const {
+    return _angular_deflection;
+}
+
+void ocgd_ArrayMeshBuilder::set_relative_deflection(bool relative) {
+    _relative_deflection = relative;
+}
+
+bool ocgd_ArrayMeshBuilder::get_relative_deflection() const {
+    return _relative_deflection;
+}
+
+void ocgd_ArrayMeshBuilder::set_include_normals(bool include) {
+    _include_normals = include;
+}
+
+bool ocgd_ArrayMeshBuilder::get_include_normals() const {
+    return _include_normals;
+}
+
+void ocgd_ArrayMeshBuilder::set_include_uvs(bool include) {
+    _include_uvs = include;
+}
+
+bool ocgd_ArrayMeshBuilder::get_include_uvs() const {
+    return _include_uvs;
+}
+
+void ocgd_ArrayMeshBuilder::set_merge_vertices(bool merge) {
+    _merge_vertices = merge;
+}
+
+bool ocgd_ArrayMeshBuilder::get_merge_vertices() const {
+    return _merge_vertices;
+}
+
+void ocgd_ArrayMeshBuilder::set_vertex_merge_tolerance(double tolerance) {
+    _vertex_merge_tolerance = tolerance;
+}
+
+double ocgd_ArrayMeshBuilder::get_vertex_merge_tolerance() const {
+    return _vertex_merge_tolerance;
+}
+
+void ocgd_ArrayMeshBuilder::set_merge_crease_angle(double angle) {
+    _merge_crease_angle = angle;
+}
+
+double ocgd_ArrayMeshBuilder::get_merge_crease_angle() const {
+    return _merge_crease_angle;
+}
+
+void ocgd_ArrayMeshBuilder::set_parallel_processing(bool parallel) {
+    _parallel_processing = parallel;
+}
+
+bool ocgd_ArrayMeshBuilder::get_parallel_processing() const {
+    return _parallel_processing;
+}
+
+void ocgd_ArrayMeshBuilder::set_worker_count(int count) {
+    _worker_count = count;
+}
+
+int ocgd_ArrayMeshBuilder::get_worker_count() const {
+    return _worker_count;
+}
+
+void ocgd_ArrayMeshBuilder::set_lod_count(int count) {
+    _lod_count = std::max(count, 0);
+}
+
+int ocgd_ArrayMeshBuilder::get_lod_count() const {
+    return _lod_count;
+}
+
+void ocgd_ArrayMeshBuilder::set_lod_deflection_factor(double factor) {
+    _lod_deflection_factor = factor;
+}
+
+double ocgd_ArrayMeshBuilder::get_lod_deflection_factor() const {
+    return _lod_deflection_factor;
+}
+
+bool ocgd_ArrayMeshBuilder::mesh_shape(const TopoDS_Shape& shape, double linear_deflection, double angular_deflection) const {
+    // Imported meshes have no surfaces to mesh; their triangulation is used as is
+    if (ocgd_MeshFileParser::is_mesh_only(shape)) {
+        return true;
+    }
+
+    // Faces whose existing triangulation already meets the deflection are kept as is
+    BRepMesh_IncrementalMesh mesher(shape, linear_deflection, _relative_deflection,
+                                    angular_deflection, _parallel_processing);
+    if (!mesher.IsDone()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Failed to triangulate shape");
+        return false;
+    }
+    return true;
+}
+
+Ref<ocgd_MeshDataExtractor> ocgd_ArrayMeshBuilder::create_extractor() const {
+    Ref<ocgd_MeshDataExtractor> extractor;
+    extractor.instantiate();
+    extractor->set_include_normals(_include_normals);
+    extractor->set_include_uvs(_include_uvs);
+    extractor->set_merge_vertices(_merge_vertices);
+    extractor->set_vertex_merge_tolerance(_vertex_merge_tolerance);
+    extractor->set_merge_crease_angle(_merge_crease_angle);
+    extractor->set_parallel_extraction(_parallel_processing);
+    extractor->set_worker_count(_worker_count);
+    return extractor;
+}
+
+bool ocgd_ArrayMeshBuilder::build_group_surfaces(const TopoDS_Shape& shape, const std::vector<int>& face_groups,
+                                                 std::vector<GroupSurface>& surfaces) const {
+    // Imported meshes cannot be retessellated, so they get no LOD levels
+    const bool mesh_only = ocgd_MeshFileParser::is_mesh_only(shape);
+    const int level_count = 1 + (_lod_deflection_factor > 1.0 && !mesh_only ? _lod_count : 0);
+    const Ref<ocgd_MeshDataExtractor> extractor = create_extractor();
+
+    // LOD keys are geometric errors in world units; relative deflections are scaled by the shape size
+    double error_scale = 1.0;
+    if (_relative_deflection && level_count > 1) {
+        Bnd_Box box;
+        BRepBndLib::Add(shape, box, Standard_False);
+        if (!box.IsVoid()) {
+            error_scale = std::sqrt(box.SquareExtent());
+        }
+    }
+
+    // Mesh coarse to fine: BRepMesh keeps any triangulation at least as fine as requested, so
+    // each finer level only remeshes what it must. The levels are meshed on a copy without
+    // triangulation, so coarse levels cannot reuse an existing mesh and the input keeps its own.
+    TopoDS_Shape mesh_target = shape;
+    if (level_count > 1) {
+        BRepBuilderAPI_Copy copier(shape, Standard_False, Standard_False);
+        mesh_target = copier.Shape();
+    }
+
+    std::vector<std::vector<ocgd_MeshDataExtractor::SurfaceArrays>> levels(level_count);
+    std::vector<double> level_errors(level_count);
+    for (int level = level_count - 1; level >= 0; level--) {
+        const double scale = std::pow(_lod_deflection_factor, level);
+        const double linear_deflection = _linear_deflection * scale;
+        const double angular_deflection = level == 0 ? _angular_deflection
+                                                     : std::min(_angular_deflection * scale, MAX_LOD_ANGULAR_DEFLECTION);
+        if (!mesh_shape(mesh_target, linear_deflection, angular_deflection)) {
+            return false;
+        }
+
+        levels[level].resize(surfaces.size());
+        extractor->extract_grouped_arrays(mesh_target, ocgd_MeshDataExtractor::MESH_PURPOSE_NONE, face_groups, levels[level]);
+        level_errors[level] = linear_deflection * error_scale;
+    }
+
+    for (size_t group = 0; group < surfaces.size(); group++) {
+        const ocgd_MeshDataExtractor::SurfaceArrays& base = levels[0][group];
+        GroupSurface& surface = surfaces[group];
+        surface.face_ranges = base.face_ranges;
+
+        PackedVector3Array vertices = base.vertices;
+        PackedVector3Array normals = base.normals;
+        PackedVector2Array uvs = base.uvs;
+        const bool has_normals = normals.size() == vertices.size();
+        const bool has_uvs = uvs.size() == vertices.size();
+
+        // Coarser levels share the base vertex buffer: their vertices are appended and their
+        // indices offset. Levels that are not actually coarser (e.g. planar faces) are dropped.
+        int64_t finer_index_count = base.triangles.size();
+        for (int level = 1; level < level_count; level++) {
+            const ocgd_MeshDataExtractor::SurfaceArrays& lod = levels[level][group];
+            if (lod.triangles.is_empty() || lod.triangles.size() >= finer_index_count) {
+                continue;
+            }
+
+            const int32_t vertex_offset = static_cast<int32_t>(vertices.size());
+            vertices.append_array(lod.vertices);
+            if (has_normals) {
+                // Zero normals would render unlit, so missing ones are rebuilt from the level's triangles
+                normals.append_array(lod.normals.size() == lod.vertices.size()
+                                         ? lod.normals
+                                         : compute_vertex_normals(lod.vertices, lod.triangles));
+            }
+            if (has_uvs) {
+                if (lod.uvs.size() == lod.vertices.size()) {
+                    uvs.append_array(lod.uvs);
+                } else {
+                    uvs.resize(vertices.size());
+                }
+            }
+
+            PackedInt32Array indices = lod.triangles;
+            int32_t* index_ptr = indices.ptrw();
+            for (int64_t i = 0; i < indices.size(); i++) {
+                index_ptr[i] += vertex_offset;
+            }
+            surface.lods[level_errors[level]] = indices;
+            finer_index_count = lod.triangles.size();
+        }
+
+        surface.valid = make_surface_arrays(vertices, base.triangles, has_normals ? normals : PackedVector3Array(),
+                                            has_uvs ? uvs : PackedVector2Array(), surface.arrays);
+    }
+    return true;
+}
+
+bool ocgd_ArrayMeshBuilder::make_surface_arrays(const PackedVector3Array& vertices, const PackedInt32Array& triangles,
+                                                const PackedVector3Array& normals, const PackedVector2Array& uvs,
+                                                Array& arrays) const {
+    if (vertices.is_empty() || triangles.is_empty()) {
+        return false;
+    }
+
+    arrays.resize(Mesh::ARRAY_MAX);
+    arrays[Mesh::ARRAY_VERTEX] = vertices;
+    arrays[Mesh::ARRAY_INDEX] = triangles;
+    if (normals.size() == vertices.size()) {
+        arrays[Mesh::ARRAY_NORMAL] = normals;
+    }
+    if (uvs.size() == vertices.size()) {
+        arrays[Mesh::ARRAY_TEX_UV] = uvs;
+    }
+    return true;
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_occt_shape(const TopoDS_Shape& shape) const {
+    try {
+        if (shape.IsNull()) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - OpenCASCADE shape is null");
+            return Ref<ArrayMesh>();
+        }
+
+        std::vector<GroupSurface> surfaces(1);
+        if (!build_group_surfaces(shape, std::vector<int>(), surfaces)) {
+            return Ref<ArrayMesh>();
+        }
+        if (!surfaces[0].valid) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: Shape produced no triangles");
+            return Ref<ArrayMesh>();
+        }
+
+        Ref<ArrayMesh> mesh;
+        mesh.instantiate();
+        mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, surfaces[0].arrays, TypedArray<Array>(), surfaces[0].lods);
+        Array face_ranges;
+        face_ranges.append(surfaces[0].face_ranges);
+        mesh->set_meta(FACE_RANGES_META, face_ranges);
+        return mesh;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building mesh - " + String(e.GetMessageString()));
+        return Ref<ArrayMesh>();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building mesh - " + String(e.what()));
+        return Ref<ArrayMesh>();
+    }
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build(const Ref<ocgd_TopoDS_Shape>& shape) const {
+    if (shape.is_null() || shape->is_null()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - shape is null");
+        return Ref<ArrayMesh>();
+    }
+    return build_occt_shape(shape->get_occt_shape());
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_from_shape(const Ref<ocgd_shape>& shape) const {
+    if (shape.is_null() || !shape->has_shape()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - shape is null");
+        return Ref<ArrayMesh>();
+    }
+    return build_occt_shape(*shape->_get_shape_ptr());
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_occt_shape_batched(const TopoDS_Shape& shape, const std::vector<Color>& face_colors) const {
+    try {
+        if (shape.IsNull()) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - OpenCASCADE shape is null");
+            return Ref<ArrayMesh>();
+        }
+
+        // Group 0 holds faces without a color, the others one distinct color each
+        std::map<Color, int, ColorLess> color_groups;
+        std::vector<Color> group_colors(1);
+        std::vector<int> face_groups(face_colors.size(), 0);
+        bool surfaces_exhausted = false;
+        for (size_t i = 0; i < face_colors.size(); i++) {
+            auto it = color_groups.find(face_colors[i]);
+            if (it != color_groups.end()) {
+                face_groups[i] = it->second;
+                continue;
+            }
+            if (static_cast<int>(group_colors.size()) >= MAX_MESH_SURFACES) {
+                surfaces_exhausted = true;
+                continue;
+            }
+            const int group = static_cast<int>(group_colors.size());
+            color_groups.emplace(face_colors[i], group);
+            group_colors.push_back(face_colors[i]);
+            face_groups[i] = group;
+        }
+        if (surfaces_exhausted) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: More than " + String::num(MAX_MESH_SURFACES - 1) +
+                                       " face colors, remaining faces are left uncolored");
+        }
+
+        std::vector<GroupSurface> surfaces(group_colors.size());
+        if (!build_group_surfaces(shape, face_groups, surfaces)) {
+            return Ref<ArrayMesh>();
+        }
+
+        Ref<ArrayMesh> mesh;
+        mesh.instantiate();
+        Array face_ranges;
+        for (size_t group = 0; group < surfaces.size(); group++) {
+            const GroupSurface& group_surface = surfaces[group];
+            if (!group_surface.valid) {
+                continue;
+            }
+
+            const int surface = mesh->get_surface_count();
+            mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, group_surface.arrays, TypedArray<Array>(), group_surface.lods);
+            face_ranges.append(group_surface.face_ranges);
+
+            if (group > 0) {
+                Ref<StandardMaterial3D> material;
+                material.instantiate();
+                material->set_albedo(group_colors[group]);
+                if (group_colors[group].a < 1.0f) {
+                    material->set_transparency(BaseMaterial3D::TRANSPARENCY_ALPHA);
+                }
+                mesh->surface_set_material(surface, material);
+            }
+        }
+
+        if (mesh->get_surface_count() == 0) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: Shape produced no triangles");
+            return Ref<ArrayMesh>();
+        }
+
+        mesh->set_meta(FACE_RANGES_META, face_ranges);
+        return mesh;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building batched mesh - " + String(e.GetMessageString()));
+        return Ref<ArrayMesh>();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building batched mesh - " + String(e.what()));
+        return Ref<ArrayMesh>();
+    }
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_batched(const Ref<ocgd_TopoDS_Shape>& shape, const PackedColorArray& face_colors) const {
+    if (shape.is_null() || shape->is_null()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - shape is null");
+        return Ref<ArrayMesh>();
+    }
+    const std::vector<Color> colors(face_colors.ptr(), face_colors.ptr() + face_colors.size());
+    return build_occt_shape_batched(shape->get_occt_shape(), colors);
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_batched_from_shape(const Ref<ocgd_shape>& shape, const PackedColorArray& face_colors) const {
+    if (shape.is_null() || !shape->has_shape()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - shape is null");
+        return Ref<ArrayMesh>();
+    }
+    const std::vector<Color> colors(face_colors.ptr(), face_colors.ptr() + face_colors.size());
+    return build_occt_shape_batched(*shape->_get_shape_ptr(), colors);
+}
+
+int ocgd_ArrayMeshBuilder::get_face_index(const Ref<ArrayMesh>& mesh, int surface, int triangle) const {
+    if (mesh.is_null() || !mesh->has_meta(FACE_RANGES_META)) {
+        return -1;
+    }
+
+    const Array face_ranges = mesh->get_meta(FACE_RANGES_META);
+    if (surface < 0 || surface >= face_ranges.size() || triangle < 0) {
+        return -1;
+    }
+
+    // Ranges are stored in triangle order: binary search for the last range starting at or before triangle
+    const PackedInt32Array ranges = face_ranges[surface];
+    int64_t low = 0;
+    int64_t high = ranges.size() / 3 - 1;
+    while (low <= high) {
+        const int64_t middle = (low + high) / 2;
+        const int32_t first = ranges[middle * 3 + 1];
+        const int32_t count = ranges[middle * 3 + 2];
+        if (triangle < first) {
+            high = middle - 1;
+        } else if (triangle >= first + count) {
+            low = middle + 1;
+        } else {
+            return ranges[middle * 3];
+        }
+    }
+    return -1;
+}
+
+Dictionary ocgd_ArrayMeshBuilder::build_mesh_data(const Ref<ocgd_TopoDS_Shape>& shape) const {
+    Dictionary result;
+
+    try {
+        if (shape.is_null() || shape->is_null()) {
+            UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh data - shape is null");
+            return result;
+        }
+
+        // Same surface as build(), so LOD levels are part of the data and survive caching
+        std::vector<GroupSurface> surfaces(1);
+        if (!build_group_surfaces(shape->get_occt_shape(), std::vector<int>(), surfaces) || !surfaces[0].valid) {
+            return result;
+        }
+
+        const Array& arrays = surfaces[0].arrays;
+        result["vertices"] = arrays[Mesh::ARRAY_VERTEX];
+        result["triangles"] = arrays[Mesh::ARRAY_INDEX];
+        if (arrays[Mesh::ARRAY_NORMAL].get_type() != Variant::NIL) {
+            result["normals"] = arrays[Mesh::ARRAY_NORMAL];
+        }
+        if (arrays[Mesh::ARRAY_TEX_UV].get_type() != Variant::NIL) {
+            result["uvs"] = arrays[Mesh::ARRAY_TEX_UV];
+        }
+        if (!surfaces[0].lods.is_empty()) {
+            result["lods"] = surfaces[0].lods;
+        }
+        return result;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building mesh data - " + String(e.GetMessageString()));
+        return Dictionary();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Exception building mesh data - " + String(e.what()));
+        return Dictionary();
+    }
+}
+
+Ref<ArrayMesh> ocgd_ArrayMeshBuilder::build_from_mesh_data(const Dictionary& mesh_data) const {
+    PackedVector3Array vertices = mesh_data.get("vertices", PackedVector3Array());
+    PackedInt32Array triangles = mesh_data.get("triangles", PackedInt32Array());
+    if (vertices.is_empty() || triangles.is_empty()) {
+        UtilityFunctions::printerr("ArrayMeshBuilder: Cannot build mesh - mesh data has no \"vertices\" or \"triangles\"");
+        return Ref<ArrayMesh>();
+    }
+
+    Array arrays;
+    arrays.resize(Mesh::ARRAY_MAX);
+    arrays[Mesh::ARRAY_VERTEX] = vertices;
+    arrays[Mesh::ARRAY_INDEX] = triangles;
+
+    // Streams are only taken when they match the vertex count, as add_surface_from_arrays requires
+    PackedVector3Array normals = mesh_data.get("normals", PackedVector3Array());
+    if (_include_normals && normals.size() == vertices.size()) {
+        arrays[Mesh::ARRAY_NORMAL] = normals;
+    }
+    PackedVector2Array uvs = mesh_data.get("uvs", PackedVector2Array());
+    if (_include_uvs && uvs.size() == vertices.size()) {
+        arrays[Mesh::ARRAY_TEX_UV] = uvs;
+    }
+
+    // LOD indices address the shared vertex buffer, which coarser levels extend
+    const Dictionary lods = mesh_data.get("lods", Dictionary());
+
+    Ref<ArrayMesh> mesh;
+    mesh.instantiate();
+    mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays, TypedArray<Array>(), lods);
+    return mesh;
+}
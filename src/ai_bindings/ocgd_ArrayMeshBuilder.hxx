@@ -0,0 +1,199 @@
+#ifndef _ocgd_ArrayMeshBuilder_HeaderFile
+#define _ocgd_ArrayMeshBuilder_HeaderFile
+
+/**
+ * ocgd_ArrayMeshBuilder.hxx
+ *
+ * Godot GDExtension builder turning OpenCASCADE shapes directly into Godot ArrayMesh resources.
+ *
+ * Building a mesh through ocgd_MeshDataExtractor::extract_mesh_data hands a Dictionary of
+ * packed arrays to GDScript, which then assembles the surface arrays itself. This builder
+ * does the whole conversion in C++: it triangulates the shape, writes vertices, normals,
+ * UVs and indices in a single extraction pass and adds the surface to the ArrayMesh.
+ *
+ * Batched builds merge all faces sharing a color into one surface with its own material,
+ * so a part with thousands of faces costs one draw call per color instead of one per face.
+ * Each batched surface keeps a face range table mapping triangles back to B-rep faces.
+ *
+ * With LOD levels enabled the shape is also tessellated at a ladder of coarser deflections.
+ * Their vertices are appended to the surface's vertex buffer and their index buffers are
+ * added as Godot mesh LODs, so distant parts render with fewer triangles automatically.
+ *
+ * Both binding flavours are accepted:
+ * - ocgd_TopoDS_Shape (this module)
+ * - ocgd_shape (ai_bindings4)
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/array_mesh.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/color.hpp>
+#include <godot_cpp/variant/packed_color_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+#include <godot_cpp/variant/packed_vector2_array.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+
+#include <opencascade/TopoDS_Shape.hxx>
+
+#include <vector>
+
+#include "ocgd_TopoDS_Shape.hxx"
+#include "ocgd_MeshDataExtractor.hxx"
+#include "../ai_bindings4/ocgd_shape.h"
+
+using namespace godot;
+
+/**
+ * ocgd_ArrayMeshBuilder
+ *
+ * Native shape to ArrayMesh conversion.
+ *
+ * Typical usage:
+ *   var builder = ocgd_ArrayMeshBuilder.new()
+ *   builder.linear_deflection = 0.05
+ *   var mesh = builder.build(shape)
+ */
+class ocgd_ArrayMeshBuilder : public RefCounted {
+    GDCLASS(ocgd_ArrayMeshBuilder, RefCounted);
+
+protected:
+    static void _bind_methods();
+
+private:
+    double _linear_deflection;
+    double _angular_deflection;
+    bool _relative_deflection;
+    bool _include_normals;
+    bool _include_uvs;
+    bool _merge_vertices;
+    double _vertex_merge_tolerance;
+    double _merge_crease_angle;
+    bool _parallel_processing;
+    int _worker_count;
+    int _lod_count;
+    double _lod_deflection_factor;
+
+    //! One built surface of a face group: Mesh arrays, LOD index buffers and face ranges
+    struct GroupSurface {
+        Array arrays;
+        Dictionary lods;
+        PackedInt32Array face_ranges;
+        bool valid = false;
+    };
+
+    //! Internal helper to triangulate a shape with the given deflections
+    bool mesh_shape(const TopoDS_Shape& shape, double linear_deflection, double angular_deflection) const;
+
+    //! Internal helper to create an extractor configured with the current settings
+    Ref<ocgd_MeshDataExtractor> create_extractor() const;
+
+    //! Internal helper to mesh a shape (at every LOD level) and build one surface per face group.
+    //! face_groups is passed to ocgd_MeshDataExtractor::extract_grouped_arrays; surfaces must be
+    //! sized to the number of groups. Returns false if meshing failed.
+    bool build_group_surfaces(const TopoDS_Shape& shape, const std::vector<int>& face_groups,
+                              std::vector<GroupSurface>& surfaces) const;
+
+    //! Internal helper to fill Mesh surface arrays from packed streams
+    //! Returns false if there are no triangles
+    bool make_surface_arrays(const PackedVector3Array& vertices, const PackedInt32Array& triangles,
+                             const PackedVector3Array& normals, const PackedVector2Array& uvs, Array& arrays) const;
+
+public:
+    //! Default constructor
+    ocgd_ArrayMeshBuilder();
+
+    //! Destructor
+    virtual ~ocgd_ArrayMeshBuilder();
+
+    // === Settings ===
+
+    //! Set linear deflection used to triangulate shapes
+    void set_linear_deflection(double deflection);
+    double get_linear_deflection() const;
+
+    //! Set angular deflection (radians) used to triangulate shapes
+    void set_angular_deflection(double deflection);
+    double get_angular_deflection() const;
+
+    //! Set whether the linear deflection is relative to the size of each edge
+    void set_relative_deflection(bool relative);
+    bool get_relative_deflection() const;
+
+    //! Set whether normals are written to the mesh
+    void set_include_normals(bool include);
+    bool get_include_normals() const;
+
+    //! Set whether UV coordinates are written to the mesh (when the triangulation has them)
+    void set_include_uvs(bool include);
+    bool get_include_uvs() const;
+
+    //! Set whether duplicate vertices are welded
+    void set_merge_vertices(bool merge);
+    bool get_merge_vertices() const;
+
+    //! Set the distance below which vertices are welded
+    void set_vertex_merge_tolerance(double tolerance);
+    double get_vertex_merge_tolerance() const;
+
+    //! Set the angle (radians) above which vertices with differing normals stay apart
+    void set_merge_crease_angle(double angle);
+    double get_merge_crease_angle() const;
+
+    //! Set whether meshing and extraction use multiple threads
+    void set_parallel_processing(bool parallel);
+    bool get_parallel_processing() const;
+
+    //! Set the number of worker threads used for extraction (0 = one per core)
+    void set_worker_count(int count);
+    int get_worker_count() const;
+
+    //! Set the number of coarser LOD levels generated below the base tessellation (0 = none)
+    void set_lod_count(int count);
+    int get_lod_count() const;
+
+    //! Set the factor by which deflections grow from one LOD level to the next coarser one
+    void set_lod_deflection_factor(double factor);
+    double get_lod_deflection_factor() const;
+
+    // === Building ===
+
+    //! Triangulate a shape and build an ArrayMesh with one surface from it
+    //! Returns a null reference if the shape is null or produced no triangles
+    Ref<ArrayMesh> build(const Ref<ocgd_TopoDS_Shape>& shape) const;
+
+    //! Same as build, for shapes of the ocgd_shape bindings
+    Ref<ArrayMesh> build_from_shape(const Ref<ocgd_shape>& shape) const;
+
+    //! Triangulate a shape and return its mesh data Dictionary in the
+    //! ocgd_MeshDataExtractor layout ("vertices", "triangles", "normals", "uvs"), plus
+    //! "lods" (error to index buffer) when LOD levels are generated
+    Dictionary build_mesh_data(const Ref<ocgd_TopoDS_Shape>& shape) const;
+
+    //! Build an ArrayMesh from a mesh data Dictionary, e.g. one loaded from ocgd_TessellationCache
+    Ref<ArrayMesh> build_from_mesh_data(const Dictionary& mesh_data) const;
+
+    //! Triangulate a shape and build an ArrayMesh with one surface per distinct face color.
+    //! face_colors holds one color per face in TopExp_Explorer order, as returned by
+    //! ocgd_CADFileImporter::get_face_colors; faces without a color share an uncolored surface.
+    //! The "face_ranges" mesh metadata holds one PackedInt32Array of
+    //! (face index, first triangle, triangle count) triples per surface.
+    Ref<ArrayMesh> build_batched(const Ref<ocgd_TopoDS_Shape>& shape, const PackedColorArray& face_colors = PackedColorArray()) const;
+
+    //! Same as build_batched, for shapes of the ocgd_shape bindings
+    Ref<ArrayMesh> build_batched_from_shape(const Ref<ocgd_shape>& shape, const PackedColorArray& face_colors = PackedColorArray()) const;
+
+    //! Look up the B-rep face index of a triangle of a batched mesh surface, -1 if unknown
+    int get_face_index(const Ref<ArrayMesh>& mesh, int surface, int triangle) const;
+
+    //! Build an ArrayMesh from an OpenCASCADE shape (C++ only)
+    Ref<ArrayMesh> build_occt_shape(const TopoDS_Shape& shape) const;
+
+    //! Build a batched ArrayMesh from an OpenCASCADE shape (C++ only)
+    Ref<ArrayMesh> build_occt_shape_batched(const TopoDS_Shape& shape, const std::vector<Color>& face_colors) const;
+};
+
+#endif // _ocgd_ArrayMeshBuilder_HeaderFile
@@ -7,26 +7,69 @@
  */
 
 #include "ocgd_BooleanOperations.hxx"
+#include "ocgd_ParallelFor.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
+#include <opencascade/BRepAlgoAPI_BooleanOperation.hxx>
 #include <opencascade/BRepAlgoAPI_Fuse.hxx>
 #include <opencascade/BRepAlgoAPI_Common.hxx>
 #include <opencascade/BRepAlgoAPI_Cut.hxx>
 #include <opencascade/BRepAlgoAPI_Section.hxx>
 #include <opencascade/BRepAlgoAPI_Splitter.hxx>
 #include <opencascade/BRepCheck_Analyzer.hxx>
+#include <opencascade/BOPAlgo_CellsBuilder.hxx>
+#include <opencascade/TopTools_ListOfShape.hxx>
 #include <opencascade/Message_ProgressRange.hxx>
 #include <opencascade/Standard_Failure.hxx>
+#include <opencascade/BRepBuilderAPI_Copy.hxx>
+#include <opencascade/BRep_Tool.hxx>
+#include <opencascade/BRepMesh_IncrementalMesh.hxx>
+#include <opencascade/Poly_Triangulation.hxx>
+#include <opencascade/TopExp.hxx>
+#include <opencascade/TopoDS.hxx>
+#include <opencascade/TopTools_IndexedMapOfShape.hxx>
+
+#include <algorithm>
+#include <chrono>
 
 using namespace godot;
 
+namespace {
+
+// The two-shape BRepAlgoAPI constructors build immediately, before any option can be set, so
+// the operands are passed through SetArguments/SetTools and the operation is built once here.
+// In non-destructive mode tolerances are raised on copies instead of on the operands' shared
+// sub-shapes, which concurrent operations on instances of one part would otherwise all write to
+void build_boolean(BRepAlgoAPI_BooleanOperation& operation, const TopoDS_Shape& shape1, const TopoDS_Shape& shape2,
+                   double fuzzy_tolerance, bool run_parallel, bool use_oriented_bbox, bool non_destructive = false) {
+    TopTools_ListOfShape arguments;
+    arguments.Append(shape1);
+    TopTools_ListOfShape tools;
+    tools.Append(shape2);
+    operation.SetArguments(arguments);
+    operation.SetTools(tools);
+    if (fuzzy_tolerance > 0) {
+        operation.SetFuzzyValue(fuzzy_tolerance);
+    }
+    operation.SetRunParallel(run_parallel);
+    operation.SetUseOBB(use_oriented_bbox);
+    operation.SetNonDestructive(non_destructive);
+    operation.Build();
+}
+
+} // namespace
+
 ocgd_BooleanOperations::ocgd_BooleanOperations() {
     _fuzzy_tolerance = 1e-6;
     _run_parallel = false;
     _check_inverted = true;
     _use_oriented_bbox = false;
+    _multi_shape_strategy = MULTI_SHAPE_SINGLE_PASS;
+    _reuse_triangulation = true;
+    _remesh_modified_faces = false;
+    _remesh_angular_deflection = 0.5;
     _last_error = "";
 }
 
@@ -66,7 +109,122 @@ bool ocgd_BooleanOperations::get_use_oriented_bbox() const {
     return _use_oriented_bbox;
 }
 
+void ocgd_BooleanOperations::set_multi_shape_strategy(int strategy) {
+    if (strategy < MULTI_SHAPE_SINGLE_PASS || strategy > MULTI_SHAPE_SEQUENTIAL) {
+        UtilityFunctions::printerr("BooleanOperations: Invalid multi-shape strategy " + String::num(strategy) + ", keeping current value");
+        return;
+    }
+    _multi_shape_strategy = strategy;
+}
+
+int ocgd_BooleanOperations::get_multi_shape_strategy() const {
+    return _multi_shape_strategy;
+}
+
+void ocgd_BooleanOperations::set_reuse_triangulation(bool reuse) {
+    _reuse_triangulation = reuse;
+}
+
+bool ocgd_BooleanOperations::get_reuse_triangulation() const {
+    return _reuse_triangulation;
+}
+
+void ocgd_BooleanOperations::set_remesh_modified_faces(bool remesh) {
+    _remesh_modified_faces = remesh;
+}
+
+bool ocgd_BooleanOperations::get_remesh_modified_faces() const {
+    return _remesh_modified_faces;
+}
+
+void ocgd_BooleanOperations::set_remesh_angular_deflection(double deflection) {
+    _remesh_angular_deflection = deflection;
+}
+
+double ocgd_BooleanOperations::get_remesh_angular_deflection() const {
+    return _remesh_angular_deflection;
+}
+
+Dictionary ocgd_BooleanOperations::get_last_remesh_statistics() const {
+    return _last_remesh_statistics;
+}
+
+void ocgd_BooleanOperations::reuse_triangulation(const Handle(BRepTools_History)& history, const TopoDS_Shape& shape1,
+                                                 const TopoDS_Shape& shape2, TopoDS_Shape& result) {
+    _last_remesh_statistics = Dictionary();
+    if (!_reuse_triangulation || history.IsNull() || result.IsNull()) {
+        return;
+    }
+
+    const auto start_time = std::chrono::steady_clock::now();
+
+    TopTools_IndexedMapOfShape result_faces;
+    TopExp::MapShapes(result, TopAbs_FACE, result_faces);
+
+    // A face that is neither modified nor removed is kept in the result as is: it shares its
+    // TShape, and with it the triangulation, with the input face. The reuse is implicit, so
+    // this only finds those faces and the finest deflection among them
+    TopTools_IndexedMapOfShape reused_faces;
+    double finest_deflection = 0.0;
+    const TopoDS_Shape inputs[2] = { shape1, shape2 };
+    for (const TopoDS_Shape& input : inputs) {
+        TopTools_IndexedMapOfShape input_faces;
+        TopExp::MapShapes(input, TopAbs_FACE, input_faces);
+        for (int i = 1; i <= input_faces.Extent(); i++) {
+            const TopoDS_Face& face = TopoDS::Face(input_faces(i));
+            TopLoc_Location location;
+            const Handle(Poly_Triangulation)& triangulation = BRep_Tool::Triangulation(face, location);
+            if (triangulation.IsNull() || history->IsRemoved(face) || !history->Modified(face).IsEmpty()) {
+                continue;
+            }
+
+            const int result_index = result_faces.FindIndex(face);
+            if (result_index == 0) {
+                continue;
+            }
+
+            reused_faces.Add(result_faces(result_index));
+            if (triangulation->Deflection() > 0.0 &&
+                (finest_deflection == 0.0 || triangulation->Deflection() < finest_deflection)) {
+                finest_deflection = triangulation->Deflection();
+            }
+        }
+    }
+
+    // Faces without triangulation are the new and modified ones. They are meshed at the finest
+    // reused deflection so the result has one mesh quality; BRepMesh keeps every reused face
+    // that already meets it and only refines coarser ones. Reused faces are shared with the
+    // inputs, so meshing happens on a copy sharing their triangulations, which becomes the result
+    int remeshed_faces = 0;
+    if (_remesh_modified_faces && reused_faces.Extent() > 0 && finest_deflection > 0.0) {
+        for (int i = 1; i <= result_faces.Extent(); i++) {
+            TopLoc_Location location;
+            if (BRep_Tool::Triangulation(TopoDS::Face(result_faces(i)), location).IsNull()) {
+                remeshed_faces++;
+            }
+        }
+        if (remeshed_faces > 0) {
+            BRepBuilderAPI_Copy copier(result, Standard_False, Standard_True);
+            BRepMesh_IncrementalMesh mesher(copier.Shape(), finest_deflection, Standard_False,
+                                            _remesh_angular_deflection, _run_parallel);
+            if (mesher.IsDone()) {
+                result = copier.Shape();
+            } else {
+                _last_warnings.append("Meshing the new and modified faces failed; the result is left unmeshed");
+                remeshed_faces = 0;
+            }
+        }
+    }
+
+    const auto end_time = std::chrono::steady_clock::now();
+    _last_remesh_statistics["reused_faces"] = reused_faces.Extent();
+    _last_remesh_statistics["remeshed_faces"] = remeshed_faces;
+    _last_remesh_statistics["linear_deflection"] = finest_deflection;
+    _last_remesh_statistics["remesh_time_ms"] = std::chrono::duration<double, std::milli>(end_time - start_time).count();
+}
+
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::union_shapes(const Ref<ocgd_TopoDS_Shape>& shape1, const Ref<ocgd_TopoDS_Shape>& shape2) {
+    _last_warnings.clear();
     if (!validate_operation_inputs(shape1, shape2)) {
         return Ref<ocgd_TopoDS_Shape>();
     }
@@ -75,18 +233,14 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::union_shapes(const Ref<ocgd_TopoD
         const TopoDS_Shape& occt_shape1 = shape1->get_occt_shape();
         const TopoDS_Shape& occt_shape2 = shape2->get_occt_shape();
         
-        BRepAlgoAPI_Fuse fuse_op(occt_shape1, occt_shape2);
-        
-        if (_fuzzy_tolerance > 0) {
-            fuse_op.SetFuzzyValue(_fuzzy_tolerance);
-        }
-        
-        fuse_op.SetRunParallel(_run_parallel);
-        fuse_op.Build();
+        BRepAlgoAPI_Fuse fuse_op;
+        build_boolean(fuse_op, occt_shape1, occt_shape2, _fuzzy_tolerance, _run_parallel, _use_oriented_bbox);
         
         if (fuse_op.IsDone() && !fuse_op.Shape().IsNull()) {
+            TopoDS_Shape result_shape = fuse_op.Shape();
+            reuse_triangulation(fuse_op.History(), occt_shape1, occt_shape2, result_shape);
             Ref<ocgd_TopoDS_Shape> result = memnew(ocgd_TopoDS_Shape);
-            result->set_occt_shape(fuse_op.Shape());
+            result->set_occt_shape(result_shape);
             _last_error = "";
             return result;
         } else {
@@ -104,6 +258,7 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::union_shapes(const Ref<ocgd_TopoD
 }
 
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::intersect_shapes(const Ref<ocgd_TopoDS_Shape>& shape1, const Ref<ocgd_TopoDS_Shape>& shape2) {
+    _last_warnings.clear();
     if (!validate_operation_inputs(shape1, shape2)) {
         return Ref<ocgd_TopoDS_Shape>();
     }
@@ -112,18 +267,14 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::intersect_shapes(const Ref<ocgd_T
         const TopoDS_Shape& occt_shape1 = shape1->get_occt_shape();
         const TopoDS_Shape& occt_shape2 = shape2->get_occt_shape();
         
-        BRepAlgoAPI_Common common_op(occt_shape1, occt_shape2);
-        
-        if (_fuzzy_tolerance > 0) {
-            common_op.SetFuzzyValue(_fuzzy_tolerance);
-        }
-        
-        common_op.SetRunParallel(_run_parallel);
-        common_op.Build();
+        BRepAlgoAPI_Common common_op;
+        build_boolean(common_op, occt_shape1, occt_shape2, _fuzzy_tolerance, _run_parallel, _use_oriented_bbox);
         
         if (common_op.IsDone() && !common_op.Shape().IsNull()) {
+            TopoDS_Shape result_shape = common_op.Shape();
+            reuse_triangulation(common_op.History(), occt_shape1, occt_shape2, result_shape);
             Ref<ocgd_TopoDS_Shape> result = memnew(ocgd_TopoDS_Shape);
-            result->set_occt_shape(common_op.Shape());
+            result->set_occt_shape(result_shape);
             _last_error = "";
             return result;
         } else {
@@ -141,6 +292,7 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::intersect_shapes(const Ref<ocgd_T
 }
 
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::subtract_shapes(const Ref<ocgd_TopoDS_Shape>& shape1, const Ref<ocgd_TopoDS_Shape>& shape2) {
+    _last_warnings.clear();
     if (!validate_operation_inputs(shape1, shape2)) {
         return Ref<ocgd_TopoDS_Shape>();
     }
@@ -149,18 +301,14 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::subtract_shapes(const Ref<ocgd_To
         const TopoDS_Shape& occt_shape1 = shape1->get_occt_shape();
         const TopoDS_Shape& occt_shape2 = shape2->get_occt_shape();
         
-        BRepAlgoAPI_Cut cut_op(occt_shape1, occt_shape2);
-        
-        if (_fuzzy_tolerance > 0) {
-            cut_op.SetFuzzyValue(_fuzzy_tolerance);
-        }
-        
-        cut_op.SetRunParallel(_run_parallel);
-        cut_op.Build();
+        BRepAlgoAPI_Cut cut_op;
+        build_boolean(cut_op, occt_shape1, occt_shape2, _fuzzy_tolerance, _run_parallel, _use_oriented_bbox);
         
         if (cut_op.IsDone() && !cut_op.Shape().IsNull()) {
+            TopoDS_Shape result_shape = cut_op.Shape();
+            reuse_triangulation(cut_op.History(), occt_shape1, occt_shape2, result_shape);
             Ref<ocgd_TopoDS_Shape> result = memnew(ocgd_TopoDS_Shape);
-            result->set_occt_shape(cut_op.Shape());
+            result->set_occt_shape(result_shape);
             _last_error = "";
             return result;
         } else {
@@ -178,6 +326,7 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::subtract_shapes(const Ref<ocgd_To
 }
 
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::section_shapes(const Ref<ocgd_TopoDS_Shape>& shape1, const Ref<ocgd_TopoDS_Shape>& shape2) {
+    _last_warnings.clear();
     if (!validate_operation_inputs(shape1, shape2)) {
         return Ref<ocgd_TopoDS_Shape>();
     }
@@ -186,13 +335,8 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::section_shapes(const Ref<ocgd_Top
         const TopoDS_Shape& occt_shape1 = shape1->get_occt_shape();
         const TopoDS_Shape& occt_shape2 = shape2->get_occt_shape();
         
-        BRepAlgoAPI_Section section_op(occt_shape1, occt_shape2);
-        
-        if (_fuzzy_tolerance > 0) {
-            section_op.SetFuzzyValue(_fuzzy_tolerance);
-        }
-        
-        section_op.Build();
+        BRepAlgoAPI_Section section_op;
+        build_boolean(section_op, occt_shape1, occt_shape2, _fuzzy_tolerance, _run_parallel, _use_oriented_bbox);
         
         if (section_op.IsDone() && !section_op.Shape().IsNull()) {
             Ref<ocgd_TopoDS_Shape> result = memnew(ocgd_TopoDS_Shape);
@@ -214,47 +358,231 @@ Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::section_shapes(const Ref<ocgd_Top
 }
 
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::union_multiple(const Array& shapes) {
+    _last_warnings.clear();
     if (shapes.size() < 2) {
         _last_error = "Need at least 2 shapes for union operation";
         return Ref<ocgd_TopoDS_Shape>();
     }
 
-    Ref<ocgd_TopoDS_Shape> result = shapes[0];
-    
-    for (int i = 1; i < shapes.size(); i++) {
-        Ref<ocgd_TopoDS_Shape> next_shape = shapes[i];
-        result = union_shapes(result, next_shape);
-        
-        if (result.is_null()) {
-            _last_error = "Multiple union failed at shape " + String::num(i);
-            return Ref<ocgd_TopoDS_Shape>();
+    if (_multi_shape_strategy == MULTI_SHAPE_SEQUENTIAL) {
+        Ref<ocgd_TopoDS_Shape> result = shapes[0];
+
+        for (int i = 1; i < shapes.size(); i++) {
+            Ref<ocgd_TopoDS_Shape> next_shape = shapes[i];
+            result = union_shapes(result, next_shape);
+
+            if (result.is_null()) {
+                _last_error = "Multiple union failed at shape " + String::num(i);
+                return Ref<ocgd_TopoDS_Shape>();
+            }
         }
+
+        return result;
     }
-    
-    return result;
+
+    return perform_multiple_operation(shapes, OPERATION_UNION);
 }
 
 Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::intersect_multiple(const Array& shapes) {
+    _last_warnings.clear();
     if (shapes.size() < 2) {
         _last_error = "Need at least 2 shapes for intersection operation";
         return Ref<ocgd_TopoDS_Shape>();
     }
 
-    Ref<ocgd_TopoDS_Shape> result = shapes[0];
-    
-    for (int i = 1; i < shapes.size(); i++) {
-        Ref<ocgd_TopoDS_Shape> next_shape = shapes[i];
-        result = intersect_shapes(result, next_shape);
-        
-        if (result.is_null()) {
-            _last_error = "Multiple intersection failed at shape " + String::num(i);
-            return Ref<ocgd_TopoDS_Shape>();
+    if (_multi_shape_strategy == MULTI_SHAPE_SEQUENTIAL) {
+        Ref<ocgd_TopoDS_Shape> result = shapes[0];
+
+        for (int i = 1; i < shapes.size(); i++) {
+            Ref<ocgd_TopoDS_Shape> next_shape = shapes[i];
+            result = intersect_shapes(result, next_shape);
+
+            if (result.is_null()) {
+                _last_error = "Multiple intersection failed at shape " + String::num(i);
+                return Ref<ocgd_TopoDS_Shape>();
+            }
+        }
+
+        return result;
+    }
+
+    return perform_multiple_operation(shapes, OPERATION_INTERSECT);
+}
+
+bool ocgd_BooleanOperations::collect_multiple_inputs(const Array& shapes, const String& operation_name, std::vector<TopoDS_Shape>& inputs) {
+    inputs.clear();
+    inputs.reserve(shapes.size());
+
+    for (int i = 0; i < shapes.size(); i++) {
+        Ref<ocgd_TopoDS_Shape> shape = shapes[i];
+        if (shape.is_null() || shape->is_null()) {
+            _last_error = "Multiple " + operation_name + " failed - shape " + String::num(i) + " is null";
+            UtilityFunctions::printerr("BooleanOperations: " + _last_error);
+            return false;
         }
+        inputs.push_back(shape->get_occt_shape());
     }
-    
+
+    return true;
+}
+
+Ref<ocgd_TopoDS_Shape> ocgd_BooleanOperations::perform_multiple_operation(const Array& shapes, OperationType operation) {
+    const String operation_name = operation == OPERATION_UNION ? "union" : "intersection";
+
+    std::vector<TopoDS_Shape> inputs;
+    if (!collect_multiple_inputs(shapes, operation_name, inputs)) {
+        return Ref<ocgd_TopoDS_Shape>();
+    }
+
+    TopoDS_Shape result_shape;
+    std::string error;
+    bool success = false;
+
+    if (_multi_shape_strategy == MULTI_SHAPE_SINGLE_PASS) {
+        success = run_single_pass(inputs, operation, result_shape, error);
+        if (!success) {
+            _last_warnings.append("Single-pass " + operation_name + " failed (" + String(error.c_str()) + "), falling back to balanced tree");
+            error.clear();
+        }
+    }
+
+    if (!success) {
+        success = run_balanced_tree(inputs, operation, result_shape, error);
+    }
+
+    if (!success || result_shape.IsNull()) {
+        _last_error = "Multiple " + operation_name + " failed: " + String(error.c_str());
+        UtilityFunctions::printerr("BooleanOperations: " + _last_error);
+        return Ref<ocgd_TopoDS_Shape>();
+    }
+
+    Ref<ocgd_TopoDS_Shape> result = memnew(ocgd_TopoDS_Shape);
+    result->set_occt_shape(result_shape);
+    _last_error = "";
     return result;
 }
 
+bool ocgd_BooleanOperations::run_single_pass(const std::vector<TopoDS_Shape>& inputs, OperationType operation,
+                                             TopoDS_Shape& result, std::string& error) const {
+    try {
+        TopTools_ListOfShape arguments;
+        for (const TopoDS_Shape& input : inputs) {
+            arguments.Append(input);
+        }
+
+        // One General Fuse intersects all arguments together; the cells builder then selects the result
+        BOPAlgo_CellsBuilder cells_builder;
+        cells_builder.SetArguments(arguments);
+        if (_fuzzy_tolerance > 0) {
+            cells_builder.SetFuzzyValue(_fuzzy_tolerance);
+        }
+        cells_builder.SetRunParallel(_run_parallel);
+        cells_builder.SetUseOBB(_use_oriented_bbox);
+        cells_builder.Perform();
+
+        if (cells_builder.HasErrors()) {
+            error = "General Fuse of all arguments reported errors";
+            return false;
+        }
+
+        if (operation == OPERATION_UNION) {
+            // Same material for every cell, so the boundaries between them are removed
+            cells_builder.AddAllToResult(1, Standard_False);
+            cells_builder.RemoveInternalBoundaries();
+        } else {
+            // Cells lying inside every argument form the common volume
+            TopTools_ListOfShape avoid;
+            cells_builder.AddToResult(arguments, avoid, 0, Standard_False);
+        }
+
+        if (cells_builder.HasErrors()) {
+            error = "Selecting the result cells reported errors";
+            return false;
+        }
+
+        result = cells_builder.Shape();
+        if (result.IsNull()) {
+            error = "General Fuse produced no result";
+            return false;
+        }
+        return true;
+
+    } catch (const Standard_Failure& e) {
+        error = e.GetMessageString();
+        return false;
+    } catch (const std::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
+
+bool ocgd_BooleanOperations::run_balanced_tree(const std::vector<TopoDS_Shape>& inputs, OperationType operation,
+                                               TopoDS_Shape& result, std::string& error) const {
+    std::vector<TopoDS_Shape> level = inputs;
+
+    while (level.size() > 1) {
+        const int pair_count = static_cast<int>(level.size() / 2);
+        std::vector<TopoDS_Shape> next_level(pair_count + level.size() % 2);
+        std::vector<std::string> pair_errors(pair_count);
+        std::vector<char> pair_success(pair_count, 0);
+
+        // Pairs of one level are independent; parallelize across pairs rather than inside each operation
+        const bool parallel_pairs = _run_parallel && pair_count > 1;
+        ocgd_ParallelFor::run(pair_count, parallel_pairs ? 0 : 1, [&](int pair) {
+            pair_success[pair] = run_pairwise(level[pair * 2], level[pair * 2 + 1], operation, _fuzzy_tolerance,
+                                              _run_parallel && !parallel_pairs, _use_oriented_bbox, parallel_pairs,
+                                              next_level[pair], pair_errors[pair]) ? 1 : 0;
+        });
+
+        for (int pair = 0; pair < pair_count; pair++) {
+            if (!pair_success[pair]) {
+                error = pair_errors[pair];
+                return false;
+            }
+        }
+
+        if (level.size() % 2 == 1) {
+            next_level.back() = level.back();
+        }
+        level.swap(next_level);
+    }
+
+    result = level.front();
+    return true;
+}
+
+bool ocgd_BooleanOperations::run_pairwise(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2, OperationType operation,
+                                          double fuzzy_tolerance, bool run_parallel, bool use_oriented_bbox,
+                                          bool non_destructive, TopoDS_Shape& result, std::string& error) {
+    try {
+        if (operation == OPERATION_UNION) {
+            BRepAlgoAPI_Fuse fuse_op;
+            build_boolean(fuse_op, shape1, shape2, fuzzy_tolerance, run_parallel, use_oriented_bbox, non_destructive);
+            if (!fuse_op.IsDone() || fuse_op.Shape().IsNull()) {
+                error = "Pairwise union failed";
+                return false;
+            }
+            result = fuse_op.Shape();
+        } else {
+            BRepAlgoAPI_Common common_op;
+            build_boolean(common_op, shape1, shape2, fuzzy_tolerance, run_parallel, use_oriented_bbox, non_destructive);
+            if (!common_op.IsDone() || common_op.Shape().IsNull()) {
+                error = "Pairwise intersection failed";
+                return false;
+            }
+            result = common_op.Shape();
+        }
+        return true;
+
+    } catch (const Standard_Failure& e) {
+        error = e.GetMessageString();
+        return false;
+    } catch (const std::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
+
 Dictionary ocgd_BooleanOperations::union_with_validation(const Ref<ocgd_TopoDS_Shape>& shape1, const Ref<ocgd_TopoDS_Shape>& shape2) {
     Dictionary result;
     
@@ -445,6 +773,24 @@ void ocgd_BooleanOperations::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_use_oriented_bbox"), &ocgd_BooleanOperations::get_use_oriented_bbox);
     ClassDB::add_property("ocgd_BooleanOperations", PropertyInfo(Variant::BOOL, "use_oriented_bbox"), "set_use_oriented_bbox", "get_use_oriented_bbox");
     
+    ClassDB::bind_method(D_METHOD("set_multi_shape_strategy", "strategy"), &ocgd_BooleanOperations::set_multi_shape_strategy);
+    ClassDB::bind_method(D_METHOD("get_multi_shape_strategy"), &ocgd_BooleanOperations::get_multi_shape_strategy);
+    ClassDB::add_property("ocgd_BooleanOperations", PropertyInfo(Variant::INT, "multi_shape_strategy"), "set_multi_shape_strategy", "get_multi_shape_strategy");
+
+    ClassDB::bind_method(D_METHOD("set_reuse_triangulation", "reuse"), &ocgd_BooleanOperations::set_reuse_triangulation);
+    ClassDB::bind_method(D_METHOD("get_reuse_triangulation"), &ocgd_BooleanOperations::get_reuse_triangulation);
+    ClassDB::add_property("ocgd_BooleanOperations", PropertyInfo(Variant::BOOL, "reuse_triangulation"), "set_reuse_triangulation", "get_reuse_triangulation");
+
+    ClassDB::bind_method(D_METHOD("set_remesh_modified_faces", "remesh"), &ocgd_BooleanOperations::set_remesh_modified_faces);
+    ClassDB::bind_method(D_METHOD("get_remesh_modified_faces"), &ocgd_BooleanOperations::get_remesh_modified_faces);
+    ClassDB::add_property("ocgd_BooleanOperations", PropertyInfo(Variant::BOOL, "remesh_modified_faces"), "set_remesh_modified_faces", "get_remesh_modified_faces");
+
+    ClassDB::bind_method(D_METHOD("set_remesh_angular_deflection", "deflection"), &ocgd_BooleanOperations::set_remesh_angular_deflection);
+    ClassDB::bind_method(D_METHOD("get_remesh_angular_deflection"), &ocgd_BooleanOperations::get_remesh_angular_deflection);
+    ClassDB::add_property("ocgd_BooleanOperations", PropertyInfo(Variant::FLOAT, "remesh_angular_deflection"), "set_remesh_angular_deflection", "get_remesh_angular_deflection");
+
+    ClassDB::bind_method(D_METHOD("get_last_remesh_statistics"), &ocgd_BooleanOperations::get_last_remesh_statistics);
+    
     // Basic Boolean operations
     ClassDB::bind_method(D_METHOD("union_shapes", "shape1", "shape2"), &ocgd_BooleanOperations::union_shapes);
     ClassDB::bind_method(D_METHOD("intersect_shapes", "shape1", "shape2"), &ocgd_BooleanOperations::intersect_shapes);
@@ -479,4 +825,9 @@ void ocgd_BooleanOperations::_bind_methods() {
     BIND_ENUM_CONSTANT(OPERATION_SUBTRACT);
     BIND_ENUM_CONSTANT(OPERATION_SECTION);
     BIND_ENUM_CONSTANT(OPERATION_SPLIT);
+
+    // Multi-shape strategy enum constants
+    BIND_ENUM_CONSTANT(MULTI_SHAPE_SINGLE_PASS);
+    BIND_ENUM_CONSTANT(MULTI_SHAPE_BALANCED_TREE);
+    BIND_ENUM_CONSTANT(MULTI_SHAPE_SEQUENTIAL);
 }
\ No newline at end of file
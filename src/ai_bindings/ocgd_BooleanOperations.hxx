@@ -23,6 +23,10 @@
  * operations with options for fuzzy tolerance, parallel processing, and
  * result validation.
  *
+ * Two-shape union, intersection and subtraction carry the triangulation of
+ * faces that survive the operation unchanged over to the result (using the
+ * operation history), so only new and modified faces have to be meshed again.
+ *
  * Original OCCT headers: <opencascade/BRepAlgoAPI_Fuse.hxx>, 
  *                       <opencascade/BRepAlgoAPI_Common.hxx>,
  *                       <opencascade/BRepAlgoAPI_Cut.hxx>
@@ -43,9 +47,13 @@
 #include <opencascade/BRepAlgoAPI_Section.hxx>
 #include <opencascade/BRepAlgoAPI_Splitter.hxx>
 #include <opencascade/Message_ProgressRange.hxx>
+#include <opencascade/BRepTools_History.hxx>
 
 #include "ocgd_TopoDS_Shape.hxx"
 
+#include <string>
+#include <vector>
+
 using namespace godot;
 
 /**
@@ -69,6 +77,10 @@ private:
     bool _run_parallel;
     bool _check_inverted;
     bool _use_oriented_bbox;
+    int _multi_shape_strategy;
+    bool _reuse_triangulation;
+    bool _remesh_modified_faces;
+    double _remesh_angular_deflection;
 
 public:
     //! Default constructor
@@ -104,6 +116,37 @@ public:
     //! Get oriented bounding box usage setting
     bool get_use_oriented_bbox() const;
 
+    //! Set how union_multiple / intersect_multiple combine their shapes
+    //! @param strategy one of MultiShapeStrategy
+    void set_multi_shape_strategy(int strategy);
+
+    //! Get the multi-shape combination strategy
+    int get_multi_shape_strategy() const;
+
+    //! Set whether faces that survive a two-shape operation unchanged are tracked; they share
+    //! their TShape, and so their triangulation, with the input
+    void set_reuse_triangulation(bool reuse);
+
+    //! Get whether unchanged faces are tracked
+    bool get_reuse_triangulation() const;
+
+    //! Set whether new and modified faces are meshed right after the operation when
+    //! triangulation was reused, at the finest linear deflection of the reused faces (off by default)
+    void set_remesh_modified_faces(bool remesh);
+
+    //! Get whether new and modified faces are meshed after the operation
+    bool get_remesh_modified_faces() const;
+
+    //! Set the angular deflection (radians) used to mesh new and modified faces
+    void set_remesh_angular_deflection(double deflection);
+
+    //! Get the angular deflection used to mesh new and modified faces
+    double get_remesh_angular_deflection() const;
+
+    //! Get statistics of the triangulation reuse of the last two-shape operation
+    //! @return Dictionary with "reused_faces", "remeshed_faces", "linear_deflection" and "remesh_time_ms"
+    Dictionary get_last_remesh_statistics() const;
+
     // Basic Two-Shape Boolean Operations
 
     //! Boolean Union (Fuse) - Combine two shapes
@@ -137,11 +180,13 @@ public:
     // Multi-Shape Boolean Operations
 
     //! Union multiple shapes into one
+    //! Uses the configured multi_shape_strategy (single General Fuse pass by default)
     //! @param shapes array of shapes to unite
     //! @return the unified shape, or null if operation failed
     Ref<ocgd_TopoDS_Shape> union_multiple(const Array& shapes);
 
     //! Intersect multiple shapes (common volume of all)
+    //! Uses the configured multi_shape_strategy (single General Fuse pass by default)
     //! @param shapes array of shapes to intersect
     //! @return the intersection shape, or null if operation failed
     Ref<ocgd_TopoDS_Shape> intersect_multiple(const Array& shapes);
@@ -256,11 +301,19 @@ public:
         OPERATION_SPLIT = 4
     };
 
+    // Strategy used by union_multiple / intersect_multiple
+    enum MultiShapeStrategy {
+        MULTI_SHAPE_SINGLE_PASS = 0,    // All shapes in one General Fuse run, balanced tree on failure
+        MULTI_SHAPE_BALANCED_TREE = 1,  // Pairwise reduction, independent pairs run concurrently
+        MULTI_SHAPE_SEQUENTIAL = 2      // Left-to-right pairwise fold
+    };
+
 private:
     // Internal state for error tracking
     String _last_error;
     Array _last_warnings;
     Dictionary _last_timing;
+    Dictionary _last_remesh_statistics;
 
     //! Internal helper to perform Boolean operation with validation
     Dictionary perform_boolean_operation(const Ref<ocgd_TopoDS_Shape>& shape1,
@@ -274,10 +327,37 @@ private:
     //! Internal helper to extract operation results
     Ref<ocgd_TopoDS_Shape> extract_operation_result(void* api_operation, const String& operation_name);
 
+    //! Internal helper finding the result faces the history reports as neither modified nor
+    //! removed, which share their triangulation with the inputs, then meshing the remaining
+    //! faces if enabled; result is then replaced by a meshed copy so the inputs stay untouched
+    void reuse_triangulation(const Handle(BRepTools_History)& history, const TopoDS_Shape& shape1,
+                             const TopoDS_Shape& shape2, TopoDS_Shape& result);
+
     //! Internal helper to collect operation messages
     void collect_operation_messages(void* api_operation);
+
+    //! Internal helper to unwrap and validate the shapes of a multi-shape operation
+    bool collect_multiple_inputs(const Array& shapes, const String& operation_name, std::vector<TopoDS_Shape>& inputs);
+
+    //! Internal helper running union_multiple / intersect_multiple with the configured strategy
+    Ref<ocgd_TopoDS_Shape> perform_multiple_operation(const Array& shapes, OperationType operation);
+
+    //! Run a fuse or common of all inputs in a single BOPAlgo_CellsBuilder pass
+    bool run_single_pass(const std::vector<TopoDS_Shape>& inputs, OperationType operation,
+                         TopoDS_Shape& result, std::string& error) const;
+
+    //! Reduce inputs pairwise, running independent pairs of each level concurrently
+    bool run_balanced_tree(const std::vector<TopoDS_Shape>& inputs, OperationType operation,
+                           TopoDS_Shape& result, std::string& error) const;
+
+    //! Run one pairwise fuse or common (touches no member state; pass non_destructive when
+    //! other pairs sharing sub-shapes with these operands run at the same time)
+    static bool run_pairwise(const TopoDS_Shape& shape1, const TopoDS_Shape& shape2, OperationType operation,
+                             double fuzzy_tolerance, bool run_parallel, bool use_oriented_bbox,
+                             bool non_destructive, TopoDS_Shape& result, std::string& error);
 };
 
 VARIANT_ENUM_CAST(ocgd_BooleanOperations::OperationType);
+VARIANT_ENUM_CAST(ocgd_BooleanOperations::MultiShapeStrategy);
 
 #endif // _ocgd_BooleanOperations_HeaderFile
\ No newline at end of file
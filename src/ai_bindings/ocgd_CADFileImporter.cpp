@@ -7,10 +7,13 @@
  */
 
 #include "ocgd_CADFileImporter.hxx"
+#include "ocgd_ParallelFor.hxx"
+#include "ocgd_MeshFileParser.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
 
 #include <opencascade/STEPCAFControl_Reader.hxx>
 #include <opencascade/IGESCAFControl_Reader.hxx>
@@ -25,9 +28,34 @@
 #include <opencascade/TColStd_HSequenceOfTransient.hxx>
 #include <opencascade/TopExp_Explorer.hxx>
 #include <opencascade/TopoDS.hxx>
+#include <opencascade/TopoDS_Face.hxx>
 #include <opencascade/TCollection_AsciiString.hxx>
+#include <opencascade/Message_ProgressScope.hxx>
 
 #include <algorithm>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Lets OCCT operations of a batch worker observe cancel_import() on the parent importer
+class ocgd_BatchCancelIndicator : public Message_ProgressIndicator {
+public:
+    explicit ocgd_BatchCancelIndicator(const std::atomic<bool>* cancelled) : _cancelled(cancelled) {}
+
+    Standard_Boolean UserBreak() override {
+        return _cancelled->load() ? Standard_True : Standard_False;
+    }
+
+    void Show(const Message_ProgressScope& /*scope*/, const Standard_Boolean /*force*/) override {}
+
+    DEFINE_STANDARD_RTTI_INLINE(ocgd_BatchCancelIndicator, Message_ProgressIndicator)
+
+private:
+    const std::atomic<bool>* _cancelled;
+};
+
+} // namespace
 
 void ocgd_CADFileImporter::_bind_methods() {
     // Enums
@@ -96,11 +124,22 @@ void ocgd_CADFileImporter::_bind_methods() {
     ClassDB::bind_method(D_METHOD("set_fix_geometry", "enabled"), &ocgd_CADFileImporter::set_fix_geometry);
     ClassDB::bind_method(D_METHOD("get_fix_geometry"), &ocgd_CADFileImporter::get_fix_geometry);
 
+    ClassDB::bind_method(D_METHOD("set_parallel_batch", "enabled"), &ocgd_CADFileImporter::set_parallel_batch);
+    ClassDB::bind_method(D_METHOD("get_parallel_batch"), &ocgd_CADFileImporter::get_parallel_batch);
+
+    ClassDB::bind_method(D_METHOD("set_batch_worker_count", "count"), &ocgd_CADFileImporter::set_batch_worker_count);
+    ClassDB::bind_method(D_METHOD("get_batch_worker_count"), &ocgd_CADFileImporter::get_batch_worker_count);
+
+    ClassDB::bind_method(D_METHOD("set_stl_mesh_only", "enabled"), &ocgd_CADFileImporter::set_stl_mesh_only);
+    ClassDB::bind_method(D_METHOD("get_stl_mesh_only"), &ocgd_CADFileImporter::get_stl_mesh_only);
+
     // Main import methods
     ClassDB::bind_method(D_METHOD("import_file", "file_path"), &ocgd_CADFileImporter::import_file);
     ClassDB::bind_method(D_METHOD("import_file_multiple", "file_path"), &ocgd_CADFileImporter::import_file_multiple);
     ClassDB::bind_method(D_METHOD("import_file_with_metadata", "file_path"), &ocgd_CADFileImporter::import_file_with_metadata);
     ClassDB::bind_method(D_METHOD("import_files_batch", "file_paths"), &ocgd_CADFileImporter::import_files_batch);
+    ClassDB::bind_method(D_METHOD("import_mesh_arrays", "file_path"), &ocgd_CADFileImporter::import_mesh_arrays);
+    ClassDB::bind_method(D_METHOD("import_file_async", "file_path"), &ocgd_CADFileImporter::import_file_async);
 
     // File information
     ClassDB::bind_method(D_METHOD("analyze_file", "file_path"), &ocgd_CADFileImporter::analyze_file);
@@ -156,6 +195,9 @@ ocgd_CADFileImporter::ocgd_CADFileImporter() :
     _fix_geometry(true),
     _scaling_factor(1.0),
     _tolerance(Precision::Confusion()),
+    _parallel_batch(false),
+    _batch_worker_count(0),
+    _stl_mesh_only(true),
     _progress_current(0),
     _progress_total(100),
     _operation_cancelled(false) {
@@ -169,8 +211,11 @@ ocgd_CADFileImporter::~ocgd_CADFileImporter() {
 
 bool ocgd_CADFileImporter::initialize_document() {
     try {
+        // Standalone document: NewDocument would register it in the shared application
+        // session, which is not thread-safe and keeps every document alive
         Handle(XCAFApp_Application) app = XCAFApp_Application::GetApplication();
-        app->NewDocument("BinXCAF", _document);
+        _document = new TDocStd_Document("BinXCAF");
+        app->InitDocument(_document);
 
         if (_document.IsNull()) {
             set_error("Failed to create XCAF document");
@@ -295,6 +340,30 @@ bool ocgd_CADFileImporter::get_fix_geometry() const {
     return _fix_geometry;
 }
 
+void ocgd_CADFileImporter::set_parallel_batch(bool enabled) {
+    _parallel_batch = enabled;
+}
+
+bool ocgd_CADFileImporter::get_parallel_batch() const {
+    return _parallel_batch;
+}
+
+void ocgd_CADFileImporter::set_batch_worker_count(int count) {
+    _batch_worker_count = std::max(0, count);
+}
+
+int ocgd_CADFileImporter::get_batch_worker_count() const {
+    return _batch_worker_count;
+}
+
+void ocgd_CADFileImporter::set_stl_mesh_only(bool enabled) {
+    _stl_mesh_only = enabled;
+}
+
+bool ocgd_CADFileImporter::get_stl_mesh_only() const {
+    return _stl_mesh_only;
+}
+
 // Main import methods
 Ref<ocgd_TopoDS_Shape> ocgd_CADFileImporter::import_file(const String& file_path) {
     try {
@@ -336,6 +405,12 @@ Ref<ocgd_TopoDS_Shape> ocgd_CADFileImporter::import_file(const String& file_path
             case FORMAT_STL:
                 import_success = import_stl_file(file_path);
                 break;
+            case FORMAT_OBJ:
+                import_success = import_obj_file(file_path);
+                break;
+            case FORMAT_PLY:
+                import_success = import_ply_file(file_path);
+                break;
             default:
                 UtilityFunctions::printerr("CADFileImporter: Unsupported file format");
                 set_error("Unsupported file format");
@@ -430,6 +505,65 @@ Dictionary ocgd_CADFileImporter::import_file_with_metadata(const String& file_pa
     return result;
 }
 
+Dictionary ocgd_CADFileImporter::import_mesh_arrays(const String& file_path) {
+    Dictionary result;
+
+    try {
+        clear_messages();
+
+        const ImportFormat format = (_format == FORMAT_AUTO) ? detect_format(file_path) : _format;
+        if (format != FORMAT_OBJ && format != FORMAT_PLY && format != FORMAT_STL) {
+            set_error("Mesh arrays can only be imported from OBJ, PLY and STL files: " + file_path);
+            return result;
+        }
+
+        ocgd_ParsedMesh mesh;
+        if (!read_mesh_file(file_path, format, mesh)) {
+            return result;
+        }
+
+        const int64_t vertex_count = mesh.vertex_count();
+        const int64_t triangle_count = mesh.triangle_count();
+
+        PackedVector3Array vertices;
+        vertices.resize(vertex_count);
+        Vector3* vertex_data = vertices.ptrw();
+        for (int64_t i = 0; i < vertex_count; i++) {
+            vertex_data[i] = Vector3(mesh.positions[i * 3], mesh.positions[i * 3 + 1], mesh.positions[i * 3 + 2]);
+        }
+
+        // Files wind counter-clockwise; Godot front faces are clockwise, as in ocgd_MeshDataExtractor
+        PackedInt32Array triangles;
+        triangles.resize(triangle_count * 3);
+        int32_t* triangle_data = triangles.ptrw();
+        for (int64_t i = 0; i < triangle_count; i++) {
+            triangle_data[i * 3] = mesh.triangles[i * 3];
+            triangle_data[i * 3 + 1] = mesh.triangles[i * 3 + 2];
+            triangle_data[i * 3 + 2] = mesh.triangles[i * 3 + 1];
+        }
+
+        result["vertices"] = vertices;
+        result["triangles"] = triangles;
+
+        if (!mesh.normals.empty()) {
+            PackedVector3Array normals;
+            normals.resize(vertex_count);
+            Vector3* normal_data = normals.ptrw();
+            for (int64_t i = 0; i < vertex_count; i++) {
+                normal_data[i] = Vector3(mesh.normals[i * 3], mesh.normals[i * 3 + 1], mesh.normals[i * 3 + 2]);
+            }
+            result["normals"] = normals;
+        }
+
+        return result;
+
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("CADFileImporter: Exception importing mesh arrays from '" + file_path + "' - " + String(e.what()));
+        set_error(String("Mesh import failed: ") + String(e.what()));
+        return Dictionary();
+    }
+}
+
 Array ocgd_CADFileImporter::import_files_batch(const PackedStringArray& file_paths) {
     Array results;
 
@@ -439,6 +573,10 @@ Array ocgd_CADFileImporter::import_files_batch(const PackedStringArray& file_pat
             return results;
         }
 
+        if (_parallel_batch) {
+            return import_files_batch_parallel(file_paths);
+        }
+
         for (int i = 0; i < file_paths.size(); i++) {
             if (should_cancel()) {
                 UtilityFunctions::printerr("CADFileImporter: Batch import cancelled at file " + String::num(i));
@@ -446,30 +584,7 @@ Array ocgd_CADFileImporter::import_files_batch(const PackedStringArray& file_pat
             }
 
             update_progress(i, file_paths.size());
-
-            Dictionary file_result;
-            file_result["file_path"] = file_paths[i];
-
-            try {
-                Ref<ocgd_TopoDS_Shape> shape = import_file(file_paths[i]);
-                if (shape.is_valid()) {
-                    file_result["shape"] = shape;
-                    file_result["success"] = true;
-                } else {
-                    file_result["success"] = false;
-                    file_result["error"] = get_last_error();
-                }
-            } catch (const Standard_Failure& e) {
-                UtilityFunctions::printerr("CADFileImporter: Exception importing file '" + file_paths[i] + "' - " + String(e.GetMessageString()));
-                file_result["success"] = false;
-                file_result["error"] = String("Import failed: ") + String(e.GetMessageString());
-            } catch (const std::exception& e) {
-                UtilityFunctions::printerr("CADFileImporter: Exception importing file '" + file_paths[i] + "' - " + String(e.what()));
-                file_result["success"] = false;
-                file_result["error"] = String("Import failed: ") + String(e.what());
-            }
-
-            results.append(file_result);
+            results.append(import_batch_entry(file_paths[i]));
         }
 
         update_progress(file_paths.size(), file_paths.size());
@@ -484,6 +599,129 @@ Array ocgd_CADFileImporter::import_files_batch(const PackedStringArray& file_pat
     }
 }
 
+Dictionary ocgd_CADFileImporter::import_batch_entry(const String& file_path) {
+    Dictionary file_result;
+    file_result["file_path"] = file_path;
+
+    try {
+        Ref<ocgd_TopoDS_Shape> shape = import_file(file_path);
+        if (shape.is_valid()) {
+            file_result["shape"] = shape;
+            file_result["success"] = true;
+        } else {
+            file_result["success"] = false;
+            file_result["error"] = get_last_error();
+        }
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("CADFileImporter: Exception importing file '" + file_path + "' - " + String(e.GetMessageString()));
+        file_result["success"] = false;
+        file_result["error"] = String("Import failed: ") + String(e.GetMessageString());
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("CADFileImporter: Exception importing file '" + file_path + "' - " + String(e.what()));
+        file_result["success"] = false;
+        file_result["error"] = String("Import failed: ") + String(e.what());
+    }
+
+    return file_result;
+}
+
+Array ocgd_CADFileImporter::import_files_batch_parallel(const PackedStringArray& file_paths) {
+    const int file_count = file_paths.size();
+    std::vector<Dictionary> file_results(file_count);
+    std::atomic<int> files_done(0);
+
+    _operation_cancelled = false;
+    update_progress(0, file_count);
+
+    // Initialize the STEP/IGES translation controllers once on this thread
+    // before readers are constructed concurrently
+    {
+        STEPCAFControl_Reader step_reader;
+        IGESCAFControl_Reader iges_reader;
+    }
+
+    Handle(Message_ProgressIndicator) cancel_indicator = new ocgd_BatchCancelIndicator(&_operation_cancelled);
+
+    ocgd_ParallelFor::run(file_count, _batch_worker_count, [&](int index) {
+        const String file_path = file_paths[index];
+
+        if (_operation_cancelled.load()) {
+            Dictionary file_result;
+            file_result["file_path"] = file_path;
+            file_result["success"] = false;
+            file_result["error"] = "Batch import cancelled";
+            file_results[index] = file_result;
+            return;
+        }
+
+        // Each file gets its own importer, readers and XCAF document
+        Ref<ocgd_CADFileImporter> worker = create_worker_importer();
+        worker->set_progress_indicator(cancel_indicator);
+        file_results[index] = worker->import_batch_entry(file_path);
+
+        _progress_current = files_done.fetch_add(1) + 1;
+    });
+
+    Array results;
+    for (int i = 0; i < file_count; i++) {
+        results.append(file_results[i]);
+    }
+
+    if (_operation_cancelled.load()) {
+        UtilityFunctions::printerr("CADFileImporter: Parallel batch import cancelled after " + String::num(files_done.load()) + " files");
+    }
+
+    update_progress(file_count, file_count);
+    return results;
+}
+
+Ref<ocgd_CADImportJob> ocgd_CADFileImporter::import_file_async(const String& file_path) {
+    if (file_path.is_empty()) {
+        set_error("Cannot start async import - file path is empty");
+        return Ref<ocgd_CADImportJob>();
+    }
+
+    Ref<ocgd_CADImportJob> job;
+    job.instantiate();
+    if (!job->start(create_worker_importer(), file_path)) {
+        set_error("Failed to start async import for: " + file_path);
+    }
+    return job;
+}
+
+void ocgd_CADFileImporter::set_progress_indicator(const Handle(Message_ProgressIndicator)& indicator) {
+    _progress_indicator = indicator;
+}
+
+Ref<ocgd_CADFileImporter> ocgd_CADFileImporter::create_worker_importer() const {
+    Ref<ocgd_CADFileImporter> worker;
+    worker.instantiate();
+    worker->_format = _format;
+    worker->_import_mode = _import_mode;
+    worker->_target_units = _target_units;
+    worker->_repair_level = _repair_level;
+    worker->_read_colors = _read_colors;
+    worker->_read_materials = _read_materials;
+    worker->_read_layers = _read_layers;
+    worker->_read_metadata = _read_metadata;
+    worker->_read_assembly_structure = _read_assembly_structure;
+    worker->_validate_geometry = _validate_geometry;
+    worker->_fix_geometry = _fix_geometry;
+    worker->_scaling_factor = _scaling_factor;
+    worker->_tolerance = _tolerance;
+    worker->_parallel_batch = _parallel_batch;
+    worker->_batch_worker_count = _batch_worker_count;
+    worker->_stl_mesh_only = _stl_mesh_only;
+    return worker;
+}
+
+Message_ProgressRange ocgd_CADFileImporter::start_progress() const {
+    if (_progress_indicator.IsNull()) {
+        return Message_ProgressRange();
+    }
+    return _progress_indicator->Start();
+}
+
 // File information methods
 Dictionary ocgd_CADFileImporter::analyze_file(const String& file_path) {
     Dictionary result;
@@ -710,13 +948,21 @@ PackedColorArray ocgd_CADFileImporter::get_face_colors(const Ref<ocgd_TopoDS_Sha
 
     const TopoDS_Shape& occt_shape = shape->get_occt_shape();
 
+    // Faces without their own color inherit the color assigned to the whole shape
+    Quantity_Color shape_color(0.7, 0.7, 0.7, Quantity_TOC_RGB);
+    if (!_color_tool.IsNull() && !_color_tool->GetColor(occt_shape, XCAFDoc_ColorSurf, shape_color)) {
+        if (!_color_tool->GetColor(occt_shape, XCAFDoc_ColorGen, shape_color)) {
+            shape_color = Quantity_Color(0.7, 0.7, 0.7, Quantity_TOC_RGB);
+        }
+    }
+
     TopExp_Explorer face_explorer(occt_shape, TopAbs_FACE);
     while (face_explorer.More()) {
         const TopoDS_Face& face = TopoDS::Face(face_explorer.Current());
 
         Quantity_Color face_color;
         if (_color_tool.IsNull() || !_color_tool->GetColor(face, XCAFDoc_ColorSurf, face_color)) {
-            face_color = Quantity_Color(0.7, 0.7, 0.7, Quantity_TOC_RGB);
+            face_color = shape_color;
         }
 
         colors.append(quantity_color_to_godot(face_color));
@@ -860,6 +1106,9 @@ void ocgd_CADFileImporter::reset_settings() {
     _fix_geometry = true;
     _scaling_factor = 1.0;
     _tolerance = Precision::Confusion();
+    _parallel_batch = false;
+    _batch_worker_count = 0;
+    _stl_mesh_only = true;
 }
 
 // Private helper methods
@@ -886,6 +1135,7 @@ ocgd_CADFileImporter::ImportFormat ocgd_CADFileImporter::auto_detect_format(cons
 bool ocgd_CADFileImporter::import_step_file(const String& file_path) {
     try {
         STEPCAFControl_Reader reader;
+        Message_ProgressScope progress(start_progress(), "STEP import", 100);
 
         IFSelect_ReturnStatus status = reader.ReadFile(file_path.utf8().get_data());
         if (status != IFSelect_RetDone) {
@@ -894,9 +1144,15 @@ bool ocgd_CADFileImporter::import_step_file(const String& file_path) {
         }
 
         update_progress(25, 100);
+        progress.Next(25);
+        if (should_cancel()) {
+            set_error("STEP import cancelled");
+            return false;
+        }
 
-        if (!reader.Transfer(_document)) {
-            set_error("Failed to transfer STEP data to document");
+        // The transfer polls the job's progress indicator, whose UserBreak stops it on cancellation
+        if (!reader.Transfer(_document, progress.Next(75)) || should_cancel()) {
+            set_error(should_cancel() ? "STEP import cancelled" : "Failed to transfer STEP data to document");
             return false;
         }
 
@@ -913,6 +1169,7 @@ bool ocgd_CADFileImporter::import_step_file(const String& file_path) {
 bool ocgd_CADFileImporter::import_iges_file(const String& file_path) {
     try {
         IGESCAFControl_Reader reader;
+        Message_ProgressScope progress(start_progress(), "IGES import", 100);
 
         IFSelect_ReturnStatus status = reader.ReadFile(file_path.utf8().get_data());
         if (status != IFSelect_RetDone) {
@@ -921,9 +1178,14 @@ bool ocgd_CADFileImporter::import_iges_file(const String& file_path) {
         }
 
         update_progress(25, 100);
+        progress.Next(25);
+        if (should_cancel()) {
+            set_error("IGES import cancelled");
+            return false;
+        }
 
-        if (!reader.Transfer(_document)) {
-            set_error("Failed to transfer IGES data to document");
+        if (!reader.Transfer(_document, progress.Next(75)) || should_cancel()) {
+            set_error(should_cancel() ? "IGES import cancelled" : "Failed to transfer IGES data to document");
             return false;
         }
 
@@ -967,6 +1229,11 @@ bool ocgd_CADFileImporter::import_brep_file(const String& file_path) {
 }
 
 bool ocgd_CADFileImporter::import_stl_file(const String& file_path) {
+    if (_stl_mesh_only) {
+        return import_mesh_file(file_path, FORMAT_STL);
+    }
+
+    // StlAPI_Reader builds one planar face per triangle, for callers that need real B-rep faces
     try {
         StlAPI_Reader reader;
         TopoDS_Shape shape;
@@ -996,13 +1263,75 @@ bool ocgd_CADFileImporter::import_stl_file(const String& file_path) {
 }
 
 bool ocgd_CADFileImporter::import_obj_file(const String& file_path) {
-    set_error("OBJ import not yet implemented");
-    return false;
+    return import_mesh_file(file_path, FORMAT_OBJ);
 }
 
 bool ocgd_CADFileImporter::import_ply_file(const String& file_path) {
-    set_error("PLY import not yet implemented");
-    return false;
+    return import_mesh_file(file_path, FORMAT_PLY);
+}
+
+bool ocgd_CADFileImporter::read_mesh_file(const String& file_path, ImportFormat format, ocgd_ParsedMesh& mesh) const {
+    // The file is memory-mapped, which needs a real file system path
+    const String global_path = ProjectSettings::get_singleton()->globalize_path(file_path);
+    const std::string path = global_path.utf8().get_data();
+
+    const char* format_name = "PLY";
+    std::string error;
+    bool parsed = false;
+    if (format == FORMAT_OBJ) {
+        format_name = "OBJ";
+        parsed = ocgd_MeshFileParser::parse_obj(path, 0, mesh, error);
+    } else if (format == FORMAT_STL) {
+        format_name = "STL";
+        parsed = ocgd_MeshFileParser::parse_stl(path, 0, mesh, error);
+    } else {
+        parsed = ocgd_MeshFileParser::parse_ply(path, 0, mesh, error);
+    }
+
+    if (!parsed) {
+        set_error(String(format_name) + " import failed: " + String::utf8(error.c_str()));
+        return false;
+    }
+    return true;
+}
+
+bool ocgd_CADFileImporter::import_mesh_file(const String& file_path, ImportFormat format) {
+    try {
+        ocgd_ParsedMesh mesh;
+        if (!read_mesh_file(file_path, format, mesh)) {
+            return false;
+        }
+
+        update_progress(50, 100);
+
+        Handle(Poly_Triangulation) triangulation = ocgd_MeshFileParser::to_triangulation(mesh, 0);
+        if (triangulation.IsNull()) {
+            set_error("Imported mesh is empty or too large");
+            return false;
+        }
+
+        // A face without a surface that only carries the triangulation, like OCCT's own
+        // mesh readers produce; it is cheap to build and exported/extracted like any face
+        TopoDS_Face face;
+        BRep_Builder builder;
+        builder.MakeFace(face, triangulation);
+
+        Ref<ocgd_TopoDS_Shape> wrapped_shape = memnew(ocgd_TopoDS_Shape);
+        wrapped_shape->set_occt_shape(face);
+        _imported_shapes.append(wrapped_shape);
+
+        _last_import_info["vertex_count"] = mesh.vertex_count();
+        _last_import_info["triangle_count"] = mesh.triangle_count();
+        update_progress(100, 100);
+        return true;
+
+    } catch (const Standard_Failure& e) {
+        set_error(String("Mesh import failed: ") + String(e.GetMessageString()));
+        return false;
+    } catch (const std::exception& e) {
+        set_error(String("Mesh import failed: ") + String(e.what()));
+        return false;
+    }
 }
 
 bool ocgd_CADFileImporter::process_xcaf_document() {
@@ -1144,7 +1473,7 @@ void ocgd_CADFileImporter::set_warning(const String& warning) const {
 }
 
 bool ocgd_CADFileImporter::should_cancel() const {
-    return _operation_cancelled;
+    return _operation_cancelled || (!_progress_indicator.IsNull() && _progress_indicator->UserBreak());
 }
 
 void ocgd_CADFileImporter::cleanup() {
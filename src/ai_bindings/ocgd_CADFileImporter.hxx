@@ -69,8 +69,14 @@
 #include <opencascade/BRepCheck_Analyzer.hxx>
 #include <opencascade/ShapeFix_Shape.hxx>
 #include <opencascade/Message_ProgressRange.hxx>
+#include <opencascade/Message_ProgressIndicator.hxx>
 
 #include "ocgd_TopoDS_Shape.hxx"
+#include "ocgd_CADImportJob.hxx"
+
+#include <atomic>
+
+struct ocgd_ParsedMesh;
 
 using namespace godot;
 
@@ -153,13 +159,22 @@ private:
     bool _fix_geometry;
     double _scaling_factor;
     double _tolerance;
+
+    // Batch options
+    bool _parallel_batch;
+    int _batch_worker_count;
+
+    // Mesh options
+    bool _stl_mesh_only;
     
     // Progress and error tracking
     mutable String _last_error;
     mutable String _last_warning;
-    mutable int _progress_current;
-    mutable int _progress_total;
-    mutable bool _operation_cancelled;
+    // Atomic so parallel batch workers can report progress and observe cancellation
+    mutable std::atomic<int> _progress_current;
+    mutable std::atomic<int> _progress_total;
+    mutable std::atomic<bool> _operation_cancelled;
+    Handle(Message_ProgressIndicator) _progress_indicator;
     
     // Import results cache
     mutable Dictionary _last_import_info;
@@ -257,6 +272,25 @@ public:
     void set_fix_geometry(bool enabled);
     bool get_fix_geometry() const;
 
+    /**
+     * @brief Enable/disable importing batch files concurrently
+     */
+    void set_parallel_batch(bool enabled);
+    bool get_parallel_batch() const;
+
+    /**
+     * @brief Set maximum number of concurrent batch imports (0 = one per core)
+     */
+    void set_batch_worker_count(int count);
+    int get_batch_worker_count() const;
+
+    /**
+     * @brief Set whether STL files are imported as a single triangulation-only face
+     * (fast, the default) instead of one planar B-rep face per triangle
+     */
+    void set_stl_mesh_only(bool enabled);
+    bool get_stl_mesh_only() const;
+
     // === Main Import Methods ===
 
     /**
@@ -279,6 +313,28 @@ public:
      */
     Array import_files_batch(const PackedStringArray& file_paths);
 
+    /**
+     * @brief Read an OBJ, PLY or STL file straight into mesh arrays, without building a shape
+     *
+     * Returns "vertices", "triangles" and (if the file has them) "normals" in the
+     * ocgd_MeshDataExtractor layout, ready for ocgd_ArrayMeshBuilder::build_from_mesh_data.
+     * Returns an empty Dictionary on failure.
+     */
+    Dictionary import_mesh_arrays(const String& file_path);
+
+    /**
+     * @brief Start importing a CAD file on a background thread
+     *
+     * The job uses a snapshot of the current settings and its own document, so this
+     * importer can be reconfigured or reused immediately.
+     */
+    Ref<ocgd_CADImportJob> import_file_async(const String& file_path);
+
+    /**
+     * @brief Attach an OCCT progress indicator used for progress and cancellation (C++ only)
+     */
+    void set_progress_indicator(const Handle(Message_ProgressIndicator)& indicator);
+
     // === File Information ===
 
     /**
@@ -451,6 +507,26 @@ private:
      */
     bool initialize_document();
 
+    /**
+     * @brief Create an independent importer with the same settings
+     */
+    Ref<ocgd_CADFileImporter> create_worker_importer() const;
+
+    /**
+     * @brief Root progress range of the attached indicator (empty if none)
+     */
+    Message_ProgressRange start_progress() const;
+
+    /**
+     * @brief Import one batch entry and describe the outcome
+     */
+    Dictionary import_batch_entry(const String& file_path);
+
+    /**
+     * @brief Import batch files concurrently, each with an isolated importer and document
+     */
+    Array import_files_batch_parallel(const PackedStringArray& file_paths);
+
     /**
      * @brief Auto-detect file format
      */
@@ -486,6 +562,16 @@ private:
      */
     bool import_ply_file(const String& file_path);
 
+    /**
+     * @brief Parse an OBJ, PLY or STL file with the memory-mapped parallel parser
+     */
+    bool read_mesh_file(const String& file_path, ImportFormat format, ocgd_ParsedMesh& mesh) const;
+
+    /**
+     * @brief Import an OBJ, PLY or STL file as a single face carrying only a Poly_Triangulation
+     */
+    bool import_mesh_file(const String& file_path, ImportFormat format);
+
     /**
      * @brief Process XCAF document after import
      */
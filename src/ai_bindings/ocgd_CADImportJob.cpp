@@ -0,0 +1,204 @@
+/**
+ * ocgd_CADImportJob.cpp
+ *
+ * Godot GDExtension implementation of background CAD file import jobs.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_CADImportJob.hxx"
+#include "ocgd_CADFileImporter.hxx"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <opencascade/Message_ProgressScope.hxx>
+#include <opencascade/Standard_Failure.hxx>
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Forwards OCCT progress and break requests of the worker importer to its job
+class ocgd_CADImportProgress : public Message_ProgressIndicator {
+public:
+    explicit ocgd_CADImportProgress(ocgd_CADImportJob* job) : _job(job) {}
+
+    Standard_Boolean UserBreak() override {
+        return _job->is_cancel_requested() ? Standard_True : Standard_False;
+    }
+
+    void Show(const Message_ProgressScope& /*scope*/, const Standard_Boolean /*force*/) override {
+        _job->report_progress(GetPosition());
+    }
+
+    DEFINE_STANDARD_RTTI_INLINE(ocgd_CADImportProgress, Message_ProgressIndicator)
+
+private:
+    ocgd_CADImportJob* _job;
+};
+
+} // namespace
+
+void ocgd_CADImportJob::_bind_methods() {
+    BIND_ENUM_CONSTANT(STATUS_PENDING);
+    BIND_ENUM_CONSTANT(STATUS_RUNNING);
+    BIND_ENUM_CONSTANT(STATUS_COMPLETED);
+    BIND_ENUM_CONSTANT(STATUS_FAILED);
+    BIND_ENUM_CONSTANT(STATUS_CANCELLED);
+
+    ClassDB::bind_method(D_METHOD("get_file_path"), &ocgd_CADImportJob::get_file_path);
+    ClassDB::bind_method(D_METHOD("get_status"), &ocgd_CADImportJob::get_status);
+    ClassDB::bind_method(D_METHOD("get_progress"), &ocgd_CADImportJob::get_progress);
+    ClassDB::bind_method(D_METHOD("is_done"), &ocgd_CADImportJob::is_done);
+    ClassDB::bind_method(D_METHOD("cancel"), &ocgd_CADImportJob::cancel);
+    ClassDB::bind_method(D_METHOD("wait"), &ocgd_CADImportJob::wait);
+    ClassDB::bind_method(D_METHOD("get_result"), &ocgd_CADImportJob::get_result);
+    ClassDB::bind_method(D_METHOD("_deliver_completion", "result"), &ocgd_CADImportJob::_deliver_completion);
+
+    ADD_SIGNAL(MethodInfo("progress_changed", PropertyInfo(Variant::INT, "progress")));
+    ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::DICTIONARY, "result")));
+}
+
+ocgd_CADImportJob::ocgd_CADImportJob() :
+    _status(STATUS_PENDING),
+    _progress(0),
+    _cancel_requested(false) {
+}
+
+ocgd_CADImportJob::~ocgd_CADImportJob() {
+    // Running jobs keep themselves alive, so the worker is normally joined by now; if the
+    // engine tears the job down early, stop OCCT at its next progress check
+    if (_worker.joinable()) {
+        _cancel_requested = true;
+        _worker.join();
+    }
+}
+
+bool ocgd_CADImportJob::start(const Ref<ocgd_CADFileImporter>& importer, const String& file_path) {
+    if (importer.is_null()) {
+        UtilityFunctions::printerr("CADImportJob: Cannot start - importer is null");
+        return false;
+    }
+
+    if (_status.load() != STATUS_PENDING) {
+        UtilityFunctions::printerr("CADImportJob: Cannot start - job was already started");
+        return false;
+    }
+
+    _file_path = file_path;
+    _importer = importer;
+    _progress_indicator = new ocgd_CADImportProgress(this);
+    _importer->set_progress_indicator(_progress_indicator);
+
+    try {
+        _status = STATUS_RUNNING;
+        _self = Ref<ocgd_CADImportJob>(this);
+        _worker = std::thread(&ocgd_CADImportJob::run, this);
+        return true;
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("CADImportJob: Failed to start worker thread - " + String(e.what()));
+        Dictionary result;
+        result["success"] = false;
+        result["error"] = String("Failed to start worker thread: ") + String(e.what());
+        result["file_path"] = _file_path;
+        finish(result, STATUS_FAILED);
+        return false;
+    }
+}
+
+void ocgd_CADImportJob::run() {
+    Dictionary result;
+
+    try {
+        result = _importer->import_file_with_metadata(_file_path);
+    } catch (const Standard_Failure& e) {
+        result["success"] = false;
+        result["error"] = String("Import failed: ") + String(e.GetMessageString());
+    } catch (const std::exception& e) {
+        result["success"] = false;
+        result["error"] = String("Import failed: ") + String(e.what());
+    }
+
+    JobStatus status = bool(result.get("success", false)) ? STATUS_COMPLETED : STATUS_FAILED;
+    if (_cancel_requested.load()) {
+        status = STATUS_CANCELLED;
+        result["success"] = false;
+        result["error"] = "Import cancelled";
+    }
+
+    result["file_path"] = _file_path;
+    finish(result, status);
+}
+
+void ocgd_CADImportJob::finish(const Dictionary& result, JobStatus status) {
+    {
+        std::lock_guard<std::mutex> lock(_result_mutex);
+        _result = result;
+    }
+
+    if (status == STATUS_COMPLETED && _progress.exchange(100) != 100) {
+        call_deferred("emit_signal", "progress_changed", 100);
+    }
+    _status = status;
+
+    // Signals are delivered on the main thread
+    call_deferred("_deliver_completion", result);
+}
+
+void ocgd_CADImportJob::_deliver_completion(const Dictionary& result) {
+    // The worker only returns after finish(), so this join is short
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+
+    // The last reference may be this one; keep the job alive until the signal has been emitted
+    Ref<ocgd_CADImportJob> self = _self;
+    _self.unref();
+    emit_signal("completed", result);
+}
+
+void ocgd_CADImportJob::report_progress(double position) {
+    const int progress = std::max(0, std::min(100, static_cast<int>(std::floor(position * 100.0))));
+    if (_progress.exchange(progress) != progress) {
+        call_deferred("emit_signal", "progress_changed", progress);
+    }
+}
+
+bool ocgd_CADImportJob::is_cancel_requested() const {
+    return _cancel_requested.load();
+}
+
+String ocgd_CADImportJob::get_file_path() const {
+    return _file_path;
+}
+
+ocgd_CADImportJob::JobStatus ocgd_CADImportJob::get_status() const {
+    return static_cast<JobStatus>(_status.load());
+}
+
+int ocgd_CADImportJob::get_progress() const {
+    return _progress.load();
+}
+
+bool ocgd_CADImportJob::is_done() const {
+    const int status = _status.load();
+    return status == STATUS_COMPLETED || status == STATUS_FAILED || status == STATUS_CANCELLED;
+}
+
+void ocgd_CADImportJob::cancel() {
+    _cancel_requested = true;
+}
+
+Dictionary ocgd_CADImportJob::wait() {
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+    return get_result();
+}
+
+Dictionary ocgd_CADImportJob::get_result() const {
+    std::lock_guard<std::mutex> lock(_result_mutex);
+    return _result;
+}
@@ -0,0 +1,143 @@
+/**
+ * ocgd_CADImportJob.hxx
+ *
+ * Godot GDExtension handle for a CAD file import running on a background thread.
+ *
+ * Jobs are created by ocgd_CADFileImporter::import_file_async. Each job owns a private
+ * copy of the importer settings and its own XCAF document, so the main thread can keep
+ * running (and start other jobs) while the file is read and transferred.
+ *
+ * Features:
+ * - Polling (get_status, get_progress, is_done) or awaiting the "completed" signal
+ * - "progress_changed" signal emitted on the main thread
+ * - Cooperative cancellation through OCCT's Message_ProgressIndicator::UserBreak
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_CADImportJob_HeaderFile
+#define _ocgd_CADImportJob_HeaderFile
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <opencascade/Message_ProgressIndicator.hxx>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace godot;
+
+class ocgd_CADFileImporter;
+
+/**
+ * @brief Handle to an asynchronous CAD file import
+ *
+ * The result Dictionary has the same layout as ocgd_CADFileImporter::import_file_with_metadata.
+ */
+class ocgd_CADImportJob : public RefCounted {
+    GDCLASS(ocgd_CADImportJob, RefCounted)
+
+public:
+    /**
+     * @brief Lifecycle of a job
+     */
+    enum JobStatus {
+        STATUS_PENDING = 0,     ///< Created, worker not started yet
+        STATUS_RUNNING = 1,     ///< Import in progress on the worker thread
+        STATUS_COMPLETED = 2,   ///< Import finished successfully
+        STATUS_FAILED = 3,      ///< Import finished with an error
+        STATUS_CANCELLED = 4    ///< Import stopped after cancel() was requested
+    };
+
+private:
+    String _file_path;
+    Ref<ocgd_CADFileImporter> _importer;
+    Handle(Message_ProgressIndicator) _progress_indicator;
+
+    std::thread _worker;
+    std::atomic<int> _status;
+    std::atomic<int> _progress;
+    std::atomic<bool> _cancel_requested;
+
+    mutable std::mutex _result_mutex;
+    Dictionary _result;
+
+    // Held from start() until "completed" has been delivered, so a job whose script
+    // references are dropped still finishes without blocking the main thread
+    Ref<ocgd_CADImportJob> _self;
+
+    void run();
+    void finish(const Dictionary& result, JobStatus status);
+
+    // Deferred to the main thread by finish(): joins the worker, emits "completed"
+    // and releases the self-reference
+    void _deliver_completion(const Dictionary& result);
+
+protected:
+    static void _bind_methods();
+
+public:
+    ocgd_CADImportJob();
+    virtual ~ocgd_CADImportJob();
+
+    /**
+     * @brief Start importing file_path on a worker thread with the given importer
+     * @param importer private importer instance, used only by the worker from now on
+     */
+    bool start(const Ref<ocgd_CADFileImporter>& importer, const String& file_path);
+
+    /**
+     * @brief Called from the importer's progress indicator on the worker thread
+     */
+    void report_progress(double position);
+
+    /**
+     * @brief Whether cancellation was requested (polled by OCCT via UserBreak)
+     */
+    bool is_cancel_requested() const;
+
+    // === Scripting API ===
+
+    /**
+     * @brief Path of the file being imported
+     */
+    String get_file_path() const;
+
+    /**
+     * @brief Current JobStatus
+     */
+    JobStatus get_status() const;
+
+    /**
+     * @brief Import progress (0-100)
+     */
+    int get_progress() const;
+
+    /**
+     * @brief Whether the job has finished (completed, failed or cancelled)
+     */
+    bool is_done() const;
+
+    /**
+     * @brief Request cooperative cancellation; the job stops at the next OCCT progress check
+     */
+    void cancel();
+
+    /**
+     * @brief Block until the job has finished and return its result
+     */
+    Dictionary wait();
+
+    /**
+     * @brief Result of a finished job (empty while running)
+     */
+    Dictionary get_result() const;
+};
+
+VARIANT_ENUM_CAST(ocgd_CADImportJob::JobStatus);
+
+#endif // _ocgd_CADImportJob_HeaderFile
@@ -0,0 +1,79 @@
+/**
+ * ocgd_FileAccessSink.hxx
+ *
+ * Internal helpers shared by the mesh exporters: a chunked output sink writing to a Godot
+ * FileAccess, and little-endian encoding of binary fields.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_FileAccessSink_HeaderFile
+#define _ocgd_FileAccessSink_HeaderFile
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Sink buffering into fixed-size chunks that are flushed to a FileAccess.
+ *
+ * Writers reserve room for a record, fill it and commit the bytes actually used; a
+ * reservation never exceeds CHUNK_SIZE. Call flush() once the last record is written.
+ */
+struct ocgd_FileAccessSink {
+    static const int64_t CHUNK_SIZE = 1 << 20;
+
+    godot::Ref<godot::FileAccess> file;
+    godot::PackedByteArray chunk;
+    int64_t size = 0;
+
+    explicit ocgd_FileAccessSink(const godot::Ref<godot::FileAccess>& p_file) : file(p_file) {
+        chunk.resize(CHUNK_SIZE);
+    }
+
+    uint8_t* reserve(int64_t bytes) {
+        if (size + bytes > CHUNK_SIZE) {
+            flush();
+        }
+        return chunk.ptrw() + size;
+    }
+    void commit(int64_t bytes) { size += bytes; }
+
+    void write(const char* data, int64_t bytes) {
+        while (bytes > 0) {
+            const int64_t part = bytes < CHUNK_SIZE ? bytes : CHUNK_SIZE;
+            std::memcpy(reserve(part), data, static_cast<size_t>(part));
+            commit(part);
+            data += part;
+            bytes -= part;
+        }
+    }
+
+    void flush() {
+        if (size == 0) {
+            return;
+        }
+        if (size == CHUNK_SIZE) {
+            file->store_buffer(chunk);
+        } else {
+            file->store_buffer(chunk.slice(0, size));
+        }
+        size = 0;
+    }
+};
+
+//! Store a float as little-endian IEEE 754, independent of the host byte order
+inline uint8_t* ocgd_put_float_le(uint8_t* dst, float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    dst[0] = static_cast<uint8_t>(bits);
+    dst[1] = static_cast<uint8_t>(bits >> 8);
+    dst[2] = static_cast<uint8_t>(bits >> 16);
+    dst[3] = static_cast<uint8_t>(bits >> 24);
+    return dst + 4;
+}
+
+#endif // _ocgd_FileAccessSink_HeaderFile
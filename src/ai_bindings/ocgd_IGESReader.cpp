@@ -7,6 +7,7 @@
  */
 
 #include "ocgd_IGESReader.hxx"
+#include "ocgd_MemoryStream.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -22,8 +23,6 @@
 #include <opencascade/TopoDS_Compound.hxx>
 #include <opencascade/Standard_Failure.hxx>
 
-#include <sstream>
-
 using namespace godot;
 
 ocgd_IGESReader::ocgd_IGESReader() {
@@ -159,19 +158,18 @@ int ocgd_IGESReader::read_stream(const String& name, const PackedByteArray& data
 
         std::string std_name = name.utf8().get_data();
         
-        // Convert PackedByteArray to std::stringstream
-        std::stringstream stream;
-        const uint8_t* raw_data = data.ptr();
-        size_t size = data.size();
+        // Read straight from the PackedByteArray memory, without copying it into a stringstream
+        ocgd_MemoryIStream stream(data.ptr(), static_cast<size_t>(data.size()));
         
-        for (size_t i = 0; i < size; ++i) {
-            stream << static_cast<char>(raw_data[i]);
+        // XSControl_Reader::ReadStream dispatches to the IGES work library, which may not
+        // support stream input in every OpenCASCADE version
+        IFSelect_ReturnStatus status = _reader->ReadStream(std_name.c_str(), stream);
+
+        if (status != IFSelect_RetDone) {
+            UtilityFunctions::printerr("IGESReader: Failed to read stream '" + name + "' - stream input may not be supported for IGES by this OpenCASCADE build");
         }
-        
-        // Note: IGESControl_Reader doesn't have ReadStream method like STEP reader
-        // This would require a more complex implementation using temporary files
-        UtilityFunctions::printerr("IGESReader: Stream reading not yet implemented for IGES format");
-        return static_cast<int>(IFSelect_RetFail);
+
+        return static_cast<int>(status);
 
     } catch (const Standard_Failure& e) {
         UtilityFunctions::printerr("IGESReader: Exception reading stream '" + name + "' - " + String(e.GetMessageString()));
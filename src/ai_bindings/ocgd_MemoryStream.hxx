@@ -0,0 +1,79 @@
+/**
+ * ocgd_MemoryStream.hxx
+ *
+ * Internal helper to expose an in-memory buffer (e.g. PackedByteArray or CharString data)
+ * as a read-only std::istream without copying it, for OCCT readers taking streams.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_MemoryStream_HeaderFile
+#define _ocgd_MemoryStream_HeaderFile
+
+#include <cstddef>
+#include <istream>
+#include <streambuf>
+
+/**
+ * @brief Read-only streambuf over an existing memory block.
+ *
+ * The get area points straight into the caller's buffer, so reads and seeks cost no
+ * allocation or copy. The buffer must outlive the streambuf and must not be modified
+ * while it is in use.
+ */
+class ocgd_MemoryStreamBuf : public std::streambuf {
+public:
+    ocgd_MemoryStreamBuf(const char* data, std::size_t size) {
+        char* begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base = 0;
+        if (direction == std::ios_base::cur) {
+            base = gptr() - eback();
+        } else if (direction == std::ios_base::end) {
+            base = egptr() - eback();
+        }
+        return seekpos(pos_type(base + offset), which);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which = std::ios_base::in) override {
+        const off_type offset = off_type(position);
+        if (!(which & std::ios_base::in) || offset < 0 || offset > egptr() - eback()) {
+            return pos_type(off_type(-1));
+        }
+        setg(eback(), eback() + offset, egptr());
+        return position;
+    }
+
+    std::streamsize showmanyc() override {
+        const std::streamsize remaining = egptr() - gptr();
+        return remaining > 0 ? remaining : -1;
+    }
+};
+
+/**
+ * @brief std::istream reading directly from an existing memory block.
+ */
+class ocgd_MemoryIStream : public std::istream {
+public:
+    ocgd_MemoryIStream(const char* data, std::size_t size)
+        : std::istream(nullptr), _buffer(data, size) {
+        rdbuf(&_buffer);
+    }
+
+    ocgd_MemoryIStream(const unsigned char* data, std::size_t size)
+        : ocgd_MemoryIStream(reinterpret_cast<const char*>(data), size) {}
+
+private:
+    ocgd_MemoryStreamBuf _buffer;
+};
+
+#endif // _ocgd_MemoryStream_HeaderFile
@@ -8,6 +8,7 @@
 
 #include "ocgd_MeshDataExtractor.hxx"
 #include "ocgd_EnhancedNormals.hxx"
+#include "ocgd_ParallelFor.hxx"
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
@@ -29,6 +30,11 @@
 #include <opencascade/BRepBndLib.hxx>
 #include <opencascade/TopoDS.hxx>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
 #include <vector>
 
 using namespace godot;
@@ -38,6 +44,10 @@ ocgd_MeshDataExtractor::ocgd_MeshDataExtractor() {
     _include_uvs = true;
     _merge_vertices = false;
     _vertex_merge_tolerance = 1e-6;
+    _merge_crease_angle = M_PI;
+    _merge_uv_tolerance = -1.0;
+    _parallel_extraction = false;
+    _worker_count = 0;
 }
 
 ocgd_MeshDataExtractor::~ocgd_MeshDataExtractor() {
@@ -76,6 +86,73 @@ double ocgd_MeshDataExtractor::get_vertex_merge_tolerance() const {
     return _vertex_merge_tolerance;
 }
 
+void ocgd_MeshDataExtractor::set_merge_crease_angle(double angle) {
+    _merge_crease_angle = angle;
+}
+
+double ocgd_MeshDataExtractor::get_merge_crease_angle() const {
+    return _merge_crease_angle;
+}
+
+void ocgd_MeshDataExtractor::set_merge_uv_tolerance(double tolerance) {
+    _merge_uv_tolerance = tolerance;
+}
+
+double ocgd_MeshDataExtractor::get_merge_uv_tolerance() const {
+    return _merge_uv_tolerance;
+}
+
+void ocgd_MeshDataExtractor::set_parallel_extraction(bool parallel) {
+    _parallel_extraction = parallel;
+}
+
+bool ocgd_MeshDataExtractor::get_parallel_extraction() const {
+    return _parallel_extraction;
+}
+
+void ocgd_MeshDataExtractor::set_worker_count(int count) {
+    _worker_count = count;
+}
+
+int ocgd_MeshDataExtractor::get_worker_count() const {
+    return _worker_count;
+}
+
+Dictionary ocgd_MeshDataExtractor::merge_mesh_data(const Dictionary& mesh_data) const {
+    Dictionary result;
+
+    try {
+        if (!mesh_data.has("vertices") || !mesh_data.has("triangles")) {
+            UtilityFunctions::printerr("MeshDataExtractor: Cannot merge mesh data - missing \"vertices\" or \"triangles\"");
+            return result;
+        }
+
+        PackedVector3Array vertices = mesh_data["vertices"];
+        PackedInt32Array triangles = mesh_data["triangles"];
+        PackedVector3Array normals = mesh_data.get("normals", PackedVector3Array());
+        PackedVector2Array uvs = mesh_data.get("uvs", PackedVector2Array());
+
+        merge_duplicate_vertices(vertices, triangles, normals, uvs);
+
+        result["vertices"] = vertices;
+        result["triangles"] = triangles;
+        if (normals.size() > 0) {
+            result["normals"] = normals;
+        }
+        if (uvs.size() > 0) {
+            result["uvs"] = uvs;
+        }
+        return result;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("MeshDataExtractor: Exception merging mesh data - " + String(e.GetMessageString()));
+        return Dictionary();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("MeshDataExtractor: Exception merging mesh data - " + String(e.what()));
+        return Dictionary();
+    }
+}
+
 Dictionary ocgd_MeshDataExtractor::extract_mesh_data(const Ref<ocgd_TopoDS_Shape>& shape, double linear_deflection, double angular_deflection, bool compute_normals) {
     return extract_mesh_data_with_purpose(shape, linear_deflection, angular_deflection, MESH_PURPOSE_NONE, compute_normals);
 }
@@ -101,96 +178,14 @@ Dictionary ocgd_MeshDataExtractor::extract_mesh_data_with_purpose(const Ref<ocgd
             return result;
         }
 
+        // Ensure triangulation with normal computation if requested
+        ensure_triangulation(shape, linear_deflection, angular_deflection, compute_normals);
+
         PackedVector3Array all_vertices;
         PackedInt32Array all_triangles;
         PackedVector3Array all_normals;
         PackedVector2Array all_uvs;
-
-        // Ensure triangulation with normal computation if requested
-        ensure_triangulation(shape, linear_deflection, angular_deflection, compute_normals);
-
-        // Explore all faces in the shape
-        TopExp_Explorer face_explorer(occt_shape, TopAbs_FACE);
-        int vertex_offset = 0;
-
-        while (face_explorer.More()) {
-            const TopoDS_Face& face = TopoDS::Face(face_explorer.Current());
-
-            try {
-                // Get triangulation for this face
-                Handle(Poly_Triangulation) triangulation = get_face_triangulation(face, purpose);
-                if (triangulation.IsNull()) {
-                    face_explorer.Next();
-                    continue;
-                }
-
-                // Use validation but be more lenient - only skip if severely corrupted
-                if (!validate_triangulation(triangulation)) {
-                    UtilityFunctions::printerr("MeshDataExtractor: Skipping face with severely corrupted triangulation");
-                    face_explorer.Next();
-                    continue;
-                }
-
-                // Get face location
-                TopLoc_Location face_location;
-                BRep_Tool::Triangulation(face, face_location);
-
-                // Convert triangulation to Godot arrays
-                Dictionary face_data = convert_triangulation_to_dict(triangulation, face_location, &face);
-
-                if (face_data.has("vertices")) {
-                    PackedVector3Array face_vertices = face_data["vertices"];
-                    PackedInt32Array face_triangles = face_data["triangles"];
-
-                    // Append vertices
-                    for (int i = 0; i < face_vertices.size(); i++) {
-                        all_vertices.append(face_vertices[i]);
-                    }
-
-                    // Append triangles with vertex offset
-                    for (int i = 0; i < face_triangles.size(); i++) {
-                        all_triangles.append(face_triangles[i] + vertex_offset);
-                    }
-
-                    // Append normals if available and requested
-                    if (_include_normals && face_data.has("normals")) {
-                        PackedVector3Array face_normals = face_data["normals"];
-                        for (int i = 0; i < face_normals.size(); i++) {
-                            all_normals.append(face_normals[i]);
-                        }
-                    }
-
-                    // Append UVs if available and requested
-                    if (_include_uvs && face_data.has("uvs")) {
-                        PackedVector2Array face_uvs = face_data["uvs"];
-                        for (int i = 0; i < face_uvs.size(); i++) {
-                            all_uvs.append(face_uvs[i]);
-                        }
-                    }
-
-                    vertex_offset += face_vertices.size();
-                }
-            } catch (const Standard_Failure& e) {
-                UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.GetMessageString()));
-                // Continue with next face
-            } catch (const std::exception& e) {
-                UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.what()));
-                // Continue with next face
-            }
-
-            face_explorer.Next();
-        }
-
-        // Apply vertex merging if requested
-        if (_merge_vertices && all_vertices.size() > 0) {
-            try {
-                merge_duplicate_vertices(all_vertices, all_triangles, all_normals, all_uvs);
-            } catch (const Standard_Failure& e) {
-                UtilityFunctions::printerr("MeshDataExtractor: Exception merging vertices - " + String(e.GetMessageString()));
-            } catch (const std::exception& e) {
-                UtilityFunctions::printerr("MeshDataExtractor: Exception merging vertices - " + String(e.what()));
-            }
-        }
+        extract_arrays(occt_shape, purpose, all_vertices, all_triangles, all_normals, all_uvs);
 
         // Build result dictionary
         result["vertices"] = all_vertices;
@@ -560,6 +555,266 @@ double ocgd_MeshDataExtractor::get_triangulated_area(const Ref<ocgd_TopoDS_Shape
     return total_area;
 }
 
+void ocgd_MeshDataExtractor::extract_arrays(const TopoDS_Shape& shape, int purpose, PackedVector3Array& vertices,
+                                            PackedInt32Array& triangles, PackedVector3Array& normals,
+                                            PackedVector2Array& uvs) const {
+    // First pass: count nodes and triangles over all faces so the output is allocated once
+    std::vector<FaceSlice> slices;
+    int total_nodes = 0;
+    int total_triangles = 0;
+    bool any_uvs = false;
+    collect_face_slices(shape, purpose, slices, total_nodes, total_triangles, any_uvs);
+
+    PackedInt32Array face_ranges;
+    write_face_slices(slices, total_nodes, total_triangles, any_uvs, vertices, triangles, normals, uvs, face_ranges);
+}
+
+void ocgd_MeshDataExtractor::extract_grouped_arrays(const TopoDS_Shape& shape, int purpose,
+                                                    const std::vector<int>& face_groups,
+                                                    std::vector<SurfaceArrays>& groups) const {
+    if (groups.empty()) {
+        return;
+    }
+
+    std::vector<FaceSlice> slices;
+    int total_nodes = 0;
+    int total_triangles = 0;
+    bool any_uvs = false;
+    collect_face_slices(shape, purpose, slices, total_nodes, total_triangles, any_uvs);
+
+    // Split the slices by group, keeping face order, and lay out each group's output ranges
+    const int group_count = static_cast<int>(groups.size());
+    std::vector<std::vector<FaceSlice>> group_slices(group_count);
+    std::vector<int> group_nodes(group_count, 0);
+    std::vector<int> group_triangles(group_count, 0);
+    for (FaceSlice& slice : slices) {
+        int group = slice.face_index < static_cast<int>(face_groups.size()) ? face_groups[slice.face_index] : 0;
+        if (group < 0 || group >= group_count) {
+            group = 0;
+        }
+        slice.node_offset = group_nodes[group];
+        slice.triangle_offset = group_triangles[group];
+        group_nodes[group] += slice.triangulation->NbNodes();
+        group_triangles[group] += slice.triangulation->NbTriangles();
+        group_slices[group].push_back(slice);
+    }
+
+    for (int group = 0; group < group_count; group++) {
+        SurfaceArrays& arrays = groups[group];
+        write_face_slices(group_slices[group], group_nodes[group], group_triangles[group], any_uvs,
+                          arrays.vertices, arrays.triangles, arrays.normals, arrays.uvs, arrays.face_ranges);
+    }
+}
+
+void ocgd_MeshDataExtractor::write_face_slices(std::vector<FaceSlice>& slices, int total_nodes, int total_triangles,
+                                               bool any_uvs, PackedVector3Array& vertices, PackedInt32Array& triangles,
+                                               PackedVector3Array& normals, PackedVector2Array& uvs,
+                                               PackedInt32Array& face_ranges) const {
+    const bool write_normals = _include_normals;
+    const bool write_uvs = _include_uvs && any_uvs;
+
+    vertices.resize(total_nodes);
+    triangles.resize(int64_t(total_triangles) * 3);
+    if (write_normals) normals.resize(total_nodes);
+    if (write_uvs) uvs.resize(total_nodes);
+
+    // Second pass: write every face straight into its range of the output arrays.
+    // Ranges are disjoint, so faces can be written concurrently.
+    Vector3* vertex_ptr = vertices.ptrw();
+    int32_t* triangle_ptr = triangles.ptrw();
+    Vector3* normal_ptr = write_normals ? normals.ptrw() : nullptr;
+    Vector2* uv_ptr = write_uvs ? uvs.ptrw() : nullptr;
+
+    const int worker_count = _parallel_extraction ? _worker_count : 1;
+    ocgd_ParallelFor::run(static_cast<int>(slices.size()), worker_count, [&](int index) {
+        FaceSlice& slice = slices[index];
+        try {
+            slice.written_triangles = write_face_slice(slice, vertex_ptr, triangle_ptr, normal_ptr, uv_ptr);
+        } catch (const Standard_Failure& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.GetMessageString()));
+            slice.written_triangles = 0;
+        } catch (const std::exception& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.what()));
+            slice.written_triangles = 0;
+        }
+    });
+
+    compact_triangle_ranges(slices, triangles);
+
+    // Face ranges as (face index, first triangle, triangle count) after compaction
+    face_ranges.resize(int64_t(slices.size()) * 3);
+    int32_t* range_ptr = face_ranges.ptrw();
+    int first_triangle = 0;
+    for (size_t i = 0; i < slices.size(); i++) {
+        range_ptr[i * 3] = slices[i].face_index;
+        range_ptr[i * 3 + 1] = first_triangle;
+        range_ptr[i * 3 + 2] = slices[i].written_triangles;
+        first_triangle += slices[i].written_triangles;
+    }
+
+    // Apply vertex merging if requested (triangle order and count are preserved)
+    if (_merge_vertices && vertices.size() > 0) {
+        try {
+            merge_duplicate_vertices(vertices, triangles, normals, uvs);
+        } catch (const Standard_Failure& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception merging vertices - " + String(e.GetMessageString()));
+        } catch (const std::exception& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception merging vertices - " + String(e.what()));
+        }
+    }
+}
+
+void ocgd_MeshDataExtractor::collect_face_slices(const TopoDS_Shape& shape, int purpose, std::vector<FaceSlice>& slices,
+                                                 int& total_nodes, int& total_triangles, bool& any_uvs) const {
+    total_nodes = 0;
+    total_triangles = 0;
+    any_uvs = false;
+
+    int face_index = -1;
+    for (TopExp_Explorer face_explorer(shape, TopAbs_FACE); face_explorer.More(); face_explorer.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(face_explorer.Current());
+        face_index++;
+
+        try {
+            FaceSlice slice;
+            slice.face = face;
+            slice.face_index = face_index;
+            slice.triangulation = BRep_Tool::Triangulation(face, slice.location, static_cast<Poly_MeshPurpose>(purpose));
+            if (slice.triangulation.IsNull()) {
+                continue;
+            }
+
+            // Use validation but be more lenient - only skip if severely corrupted
+            if (!validate_triangulation(slice.triangulation)) {
+                UtilityFunctions::printerr("MeshDataExtractor: Skipping face with severely corrupted triangulation");
+                continue;
+            }
+
+            slice.node_offset = total_nodes;
+            slice.triangle_offset = total_triangles;
+            total_nodes += slice.triangulation->NbNodes();
+            total_triangles += slice.triangulation->NbTriangles();
+            any_uvs = any_uvs || slice.triangulation->HasUVNodes();
+            slices.push_back(slice);
+        } catch (const Standard_Failure& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.GetMessageString()));
+        } catch (const std::exception& e) {
+            UtilityFunctions::printerr("MeshDataExtractor: Exception processing face - " + String(e.what()));
+        }
+    }
+}
+
+int ocgd_MeshDataExtractor::write_face_slice(const FaceSlice& slice, Vector3* vertices, int32_t* triangles,
+                                             Vector3* normals, Vector2* uvs) const {
+    const Handle(Poly_Triangulation)& triangulation = slice.triangulation;
+    const Standard_Integer nb_nodes = triangulation->NbNodes();
+    const Standard_Integer nb_triangles = triangulation->NbTriangles();
+    const bool has_location = !slice.location.IsIdentity();
+    const gp_Trsf transformation = has_location ? slice.location.Transformation() : gp_Trsf();
+
+    // Vertices
+    Vector3* face_vertices = vertices + slice.node_offset;
+    for (Standard_Integer i = 1; i <= nb_nodes; i++) {
+        gp_Pnt point = triangulation->Node(i);
+        if (has_location) {
+            point.Transform(transformation);
+        }
+        face_vertices[i - 1] = Vector3(
+            static_cast<float>(point.X()),
+            static_cast<float>(point.Y()),
+            static_cast<float>(point.Z())
+        );
+    }
+
+    // Triangles, converted to 0-based global indices with winding matching the face orientation
+    const bool is_reversed = slice.face.Orientation() == TopAbs_REVERSED;
+    int32_t* face_triangles = triangles + int64_t(slice.triangle_offset) * 3;
+    int written = 0;
+    for (Standard_Integer i = 1; i <= nb_triangles; i++) {
+        Standard_Integer n1, n2, n3;
+        triangulation->Triangle(i).Get(n1, n2, n3);
+
+        if (n1 < 1 || n1 > nb_nodes || n2 < 1 || n2 > nb_nodes || n3 < 1 || n3 > nb_nodes) {
+            UtilityFunctions::printerr("MeshDataExtractor: Invalid triangle node indices - Triangle " + String::num(i) +
+                                     ": n1=" + String::num(n1) + ", n2=" + String::num(n2) + ", n3=" + String::num(n3) +
+                                     ", max_nodes=" + String::num(nb_nodes) + ", skipping triangle");
+            continue;
+        }
+
+        int32_t* out = face_triangles + written * 3;
+        out[0] = slice.node_offset + n1 - 1;
+        out[1] = slice.node_offset + (is_reversed ? n2 : n3) - 1;
+        out[2] = slice.node_offset + (is_reversed ? n3 : n2) - 1;
+        written++;
+    }
+
+    // Normals: stored ones when available, otherwise accumulated from the triangle geometry
+    if (normals) {
+        Vector3* face_normals = normals + slice.node_offset;
+        if (triangulation->HasNormals()) {
+            for (Standard_Integer i = 1; i <= nb_nodes; i++) {
+                gp_Vec normal_vec(triangulation->Normal(i));
+                if (has_location) {
+                    normal_vec.Transform(transformation);
+                }
+                face_normals[i - 1] = Vector3(
+                    static_cast<float>(normal_vec.X()),
+                    static_cast<float>(normal_vec.Y()),
+                    static_cast<float>(normal_vec.Z())
+                );
+            }
+        } else {
+            for (Standard_Integer i = 0; i < nb_nodes; i++) {
+                face_normals[i] = Vector3(0, 0, 0);
+            }
+            for (int t = 0; t < written; t++) {
+                const int32_t* tri = face_triangles + t * 3;
+                Vector3 triangle_normal = (vertices[tri[1]] - vertices[tri[0]]).cross(vertices[tri[2]] - vertices[tri[0]]);
+                if (triangle_normal.length() > 1e-6) {
+                    triangle_normal = triangle_normal.normalized();
+                    normals[tri[0]] += triangle_normal;
+                    normals[tri[1]] += triangle_normal;
+                    normals[tri[2]] += triangle_normal;
+                }
+            }
+            for (Standard_Integer i = 0; i < nb_nodes; i++) {
+                if (face_normals[i].length() > 1e-6) {
+                    face_normals[i] = face_normals[i].normalized();
+                } else {
+                    face_normals[i] = Vector3(0, 0, 1); // Default normal for degenerate cases
+                }
+            }
+        }
+    }
+
+    // UVs: faces without UV nodes keep the zero-initialized values so arrays stay aligned
+    if (uvs && triangulation->HasUVNodes()) {
+        Vector2* face_uvs = uvs + slice.node_offset;
+        for (Standard_Integer i = 1; i <= nb_nodes; i++) {
+            const gp_Pnt2d uv = triangulation->UVNode(i);
+            face_uvs[i - 1] = Vector2(static_cast<float>(uv.X()), static_cast<float>(uv.Y()));
+        }
+    }
+
+    return written;
+}
+
+void ocgd_MeshDataExtractor::compact_triangle_ranges(const std::vector<FaceSlice>& slices, PackedInt32Array& triangles) const {
+    int32_t* triangle_ptr = triangles.ptrw();
+    int64_t cursor = 0;
+    for (const FaceSlice& slice : slices) {
+        const int64_t start = int64_t(slice.triangle_offset) * 3;
+        const int64_t count = int64_t(slice.written_triangles) * 3;
+        if (start != cursor && count > 0) {
+            std::memmove(triangle_ptr + cursor, triangle_ptr + start, size_t(count) * sizeof(int32_t));
+        }
+        cursor += count;
+    }
+    if (cursor != triangles.size()) {
+        triangles.resize(cursor);
+    }
+}
+
 Handle(Poly_Triangulation) ocgd_MeshDataExtractor::get_face_triangulation(const TopoDS_Face& face, int purpose) const {
     TopLoc_Location location;
     return BRep_Tool::Triangulation(face, location, static_cast<Poly_MeshPurpose>(purpose));
@@ -1251,67 +1506,132 @@ void ocgd_MeshDataExtractor::apply_transformation(PackedVector3Array& vertices,
 
 void ocgd_MeshDataExtractor::merge_duplicate_vertices(PackedVector3Array& vertices, PackedInt32Array& triangles,
                                                      PackedVector3Array& normals, PackedVector2Array& uvs) const {
-    if (vertices.size() == 0) return;
-
-    // Simple vertex merging implementation
-    std::vector<int> index_map(vertices.size());
-    std::vector<Vector3> unique_vertices;
-    std::vector<Vector3> unique_normals;
-    std::vector<Vector2> unique_uvs;
-
-    const double tolerance_sq = _vertex_merge_tolerance * _vertex_merge_tolerance;
-
-    for (int i = 0; i < vertices.size(); i++) {
-        const Vector3& vertex = vertices[i];
-        bool found = false;
-
-        // Look for existing vertex within tolerance
-        for (int j = 0; j < unique_vertices.size(); j++) {
-            const Vector3& existing = unique_vertices[j];
-            double dist_sq = vertex.distance_squared_to(existing);
+    const int64_t vertex_count = vertices.size();
+    if (vertex_count == 0) return;
+
+    // Attributes are remapped together with the vertices, so they must be absent or per-vertex
+    if ((normals.size() > 0 && normals.size() != vertex_count) || (uvs.size() > 0 && uvs.size() != vertex_count)) {
+        UtilityFunctions::printerr("MeshDataExtractor: Cannot merge vertices - " + String::num_int64(normals.size()) +
+                                   " normals and " + String::num_int64(uvs.size()) + " UVs for " +
+                                   String::num_int64(vertex_count) + " vertices");
+        return;
+    }
 
-            if (dist_sq < tolerance_sq) {
-                index_map[i] = j;
-                found = true;
-                break;
+    const bool has_normals = normals.size() == vertex_count;
+    const bool has_uvs = uvs.size() == vertex_count;
+    const bool check_normals = has_normals && _merge_crease_angle < M_PI;
+    const bool check_uvs = has_uvs && _merge_uv_tolerance >= 0.0;
+
+    // Grid hashing: with a cell size equal to the tolerance, any vertex within tolerance
+    // of a given vertex lies in the same cell or in one of its 26 neighbours, so each
+    // vertex only has to be compared against a handful of candidates instead of all
+    // unique vertices seen so far.
+    const double tolerance = std::max(_vertex_merge_tolerance, 1e-12);
+    const double tolerance_sq = tolerance * tolerance;
+    const double inv_cell_size = 1.0 / tolerance;
+    const double min_normal_dot = check_normals ? std::cos(_merge_crease_angle) : -1.0;
+    const double uv_tolerance_sq = _merge_uv_tolerance * _merge_uv_tolerance;
+
+    auto cell_hash = [](int64_t x, int64_t y, int64_t z) -> uint64_t {
+        // Hash collisions only lengthen the candidate chains, every candidate is distance-checked
+        return (uint64_t(x) * 73856093ULL) ^ (uint64_t(y) * 19349663ULL) ^ (uint64_t(z) * 83492791ULL);
+    };
+
+    const Vector3* src_vertices = vertices.ptr();
+    const Vector3* src_normals = has_normals ? normals.ptr() : nullptr;
+    const Vector2* src_uvs = has_uvs ? uvs.ptr() : nullptr;
+
+    // Each cell stores the head of an intrusive linked list of unique vertices (by source index)
+    std::unordered_map<uint64_t, int32_t> cell_heads;
+    cell_heads.reserve(static_cast<size_t>(vertex_count));
+    std::vector<int32_t> next_in_cell(vertex_count, -1);
+    std::vector<int32_t> index_map(vertex_count);
+    std::vector<int32_t> unique_sources;
+    unique_sources.reserve(static_cast<size_t>(vertex_count));
+
+    for (int64_t i = 0; i < vertex_count; i++) {
+        const Vector3& vertex = src_vertices[i];
+        const int64_t cx = static_cast<int64_t>(std::floor(vertex.x * inv_cell_size));
+        const int64_t cy = static_cast<int64_t>(std::floor(vertex.y * inv_cell_size));
+        const int64_t cz = static_cast<int64_t>(std::floor(vertex.z * inv_cell_size));
+
+        // Pick the earliest matching unique vertex so the result does not depend on hash order
+        int32_t match = -1;
+        for (int64_t dx = -1; dx <= 1; dx++) {
+            for (int64_t dy = -1; dy <= 1; dy++) {
+                for (int64_t dz = -1; dz <= 1; dz++) {
+                    auto it = cell_heads.find(cell_hash(cx + dx, cy + dy, cz + dz));
+                    if (it == cell_heads.end()) {
+                        continue;
+                    }
+                    for (int32_t candidate = it->second; candidate >= 0; candidate = next_in_cell[candidate]) {
+                        const int32_t unique_index = index_map[candidate];
+                        if (match >= 0 && unique_index >= match) {
+                            continue;
+                        }
+                        if (vertex.distance_squared_to(src_vertices[candidate]) >= tolerance_sq) {
+                            continue;
+                        }
+                        if (check_normals && src_normals[i].dot(src_normals[candidate]) < min_normal_dot) {
+                            continue;
+                        }
+                        if (check_uvs && src_uvs[i].distance_squared_to(src_uvs[candidate]) > uv_tolerance_sq) {
+                            continue;
+                        }
+                        match = unique_index;
+                    }
+                }
             }
         }
 
-        if (!found) {
-            // Add new unique vertex
-            index_map[i] = unique_vertices.size();
-            unique_vertices.push_back(vertex);
-
-            if (i < normals.size()) {
-                unique_normals.push_back(normals[i]);
-            }
-
-            if (i < uvs.size()) {
-                unique_uvs.push_back(uvs[i]);
-            }
+        if (match >= 0) {
+            index_map[i] = match;
+            continue;
         }
-    }
-
-    // Rebuild arrays with unique vertices
-    vertices.clear();
-    normals.clear();
-    uvs.clear();
 
-    for (const Vector3& vertex : unique_vertices) {
-        vertices.append(vertex);
+        // Add new unique vertex
+        index_map[i] = static_cast<int32_t>(unique_sources.size());
+        unique_sources.push_back(static_cast<int32_t>(i));
+        int32_t& head = cell_heads.try_emplace(cell_hash(cx, cy, cz), -1).first->second;
+        next_in_cell[i] = head;
+        head = static_cast<int32_t>(i);
     }
 
-    for (const Vector3& normal : unique_normals) {
-        normals.append(normal);
+    if (static_cast<int64_t>(unique_sources.size()) == vertex_count) {
+        return; // Nothing to weld
     }
 
-    for (const Vector2& uv : unique_uvs) {
-        uvs.append(uv);
+    // Rebuild arrays with unique vertices, allocating each output once
+    const int64_t unique_count = static_cast<int64_t>(unique_sources.size());
+    PackedVector3Array merged_vertices;
+    PackedVector3Array merged_normals;
+    PackedVector2Array merged_uvs;
+    merged_vertices.resize(unique_count);
+    if (has_normals) merged_normals.resize(unique_count);
+    if (has_uvs) merged_uvs.resize(unique_count);
+
+    Vector3* dst_vertices = merged_vertices.ptrw();
+    Vector3* dst_normals = has_normals ? merged_normals.ptrw() : nullptr;
+    Vector2* dst_uvs = has_uvs ? merged_uvs.ptrw() : nullptr;
+    for (int64_t u = 0; u < unique_count; u++) {
+        const int32_t source = unique_sources[u];
+        dst_vertices[u] = src_vertices[source];
+        if (dst_normals) dst_normals[u] = src_normals[source];
+        if (dst_uvs) dst_uvs[u] = src_uvs[source];
     }
 
+    vertices = merged_vertices;
+    if (has_normals) normals = merged_normals;
+    if (has_uvs) uvs = merged_uvs;
+
     // Update triangle indices
-    for (int i = 0; i < triangles.size(); i++) {
-        triangles[i] = index_map[triangles[i]];
+    int32_t* dst_triangles = triangles.ptrw();
+    const int64_t index_count = triangles.size();
+    for (int64_t i = 0; i < index_count; i++) {
+        const int32_t index = dst_triangles[i];
+        if (index >= 0 && index < vertex_count) {
+            dst_triangles[i] = index_map[index];
+        }
     }
 }
 
@@ -1377,6 +1697,22 @@ void ocgd_MeshDataExtractor::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_vertex_merge_tolerance"), &ocgd_MeshDataExtractor::get_vertex_merge_tolerance);
     ClassDB::add_property("ocgd_MeshDataExtractor", PropertyInfo(Variant::FLOAT, "vertex_merge_tolerance"), "set_vertex_merge_tolerance", "get_vertex_merge_tolerance");
 
+    ClassDB::bind_method(D_METHOD("set_merge_crease_angle", "angle"), &ocgd_MeshDataExtractor::set_merge_crease_angle);
+    ClassDB::bind_method(D_METHOD("get_merge_crease_angle"), &ocgd_MeshDataExtractor::get_merge_crease_angle);
+    ClassDB::add_property("ocgd_MeshDataExtractor", PropertyInfo(Variant::FLOAT, "merge_crease_angle"), "set_merge_crease_angle", "get_merge_crease_angle");
+
+    ClassDB::bind_method(D_METHOD("set_merge_uv_tolerance", "tolerance"), &ocgd_MeshDataExtractor::set_merge_uv_tolerance);
+    ClassDB::bind_method(D_METHOD("get_merge_uv_tolerance"), &ocgd_MeshDataExtractor::get_merge_uv_tolerance);
+    ClassDB::add_property("ocgd_MeshDataExtractor", PropertyInfo(Variant::FLOAT, "merge_uv_tolerance"), "set_merge_uv_tolerance", "get_merge_uv_tolerance");
+
+    ClassDB::bind_method(D_METHOD("set_parallel_extraction", "parallel"), &ocgd_MeshDataExtractor::set_parallel_extraction);
+    ClassDB::bind_method(D_METHOD("get_parallel_extraction"), &ocgd_MeshDataExtractor::get_parallel_extraction);
+    ClassDB::add_property("ocgd_MeshDataExtractor", PropertyInfo(Variant::BOOL, "parallel_extraction"), "set_parallel_extraction", "get_parallel_extraction");
+
+    ClassDB::bind_method(D_METHOD("set_worker_count", "count"), &ocgd_MeshDataExtractor::set_worker_count);
+    ClassDB::bind_method(D_METHOD("get_worker_count"), &ocgd_MeshDataExtractor::get_worker_count);
+    ClassDB::add_property("ocgd_MeshDataExtractor", PropertyInfo(Variant::INT, "worker_count"), "set_worker_count", "get_worker_count");
+
     // Main extraction methods
     ClassDB::bind_method(D_METHOD("extract_mesh_data", "shape", "linear_deflection", "angular_deflection", "compute_normals"), &ocgd_MeshDataExtractor::extract_mesh_data, DEFVAL(0.1), DEFVAL(0.1), DEFVAL(true));
     ClassDB::bind_method(D_METHOD("extract_face_data", "face", "linear_deflection", "angular_deflection", "compute_normals"), &ocgd_MeshDataExtractor::extract_face_data, DEFVAL(0.1), DEFVAL(0.1), DEFVAL(true));
@@ -1388,6 +1724,7 @@ void ocgd_MeshDataExtractor::_bind_methods() {
     ClassDB::bind_method(D_METHOD("extract_uvs", "shape"), &ocgd_MeshDataExtractor::extract_uvs);
     ClassDB::bind_method(D_METHOD("extract_per_face_data", "shape"), &ocgd_MeshDataExtractor::extract_per_face_data);
     ClassDB::bind_method(D_METHOD("extract_mesh_data_with_purpose", "shape", "purpose"), &ocgd_MeshDataExtractor::extract_mesh_data_with_purpose);
+    ClassDB::bind_method(D_METHOD("merge_mesh_data", "mesh_data"), &ocgd_MeshDataExtractor::merge_mesh_data);
 
     // Query methods
     ClassDB::bind_method(D_METHOD("has_triangulation", "shape"), &ocgd_MeshDataExtractor::has_triangulation);
@@ -50,6 +50,8 @@
 
 #include <opencascade/gp_Vec3f.hxx>
 
+#include <vector>
+
 #include "ocgd_TopoDS_Shape.hxx"
 
 using namespace godot;
@@ -79,6 +81,10 @@ private:
     bool _include_uvs;
     bool _merge_vertices;
     double _vertex_merge_tolerance;
+    double _merge_crease_angle;
+    double _merge_uv_tolerance;
+    bool _parallel_extraction;
+    int _worker_count;
 
 public:
     //! Default constructor
@@ -111,6 +117,40 @@ public:
     //! Get vertex merging tolerance
     double get_vertex_merge_tolerance() const;
 
+    //! Set the maximum angle (radians) between normals of vertices that may be welded.
+    //! Vertices whose normals differ by more than this angle are kept apart (hard crease).
+    //! A value of PI or more disables the normal check.
+    void set_merge_crease_angle(double angle);
+
+    //! Get the maximum normal angle used for vertex welding
+    double get_merge_crease_angle() const;
+
+    //! Set the maximum UV distance between vertices that may be welded.
+    //! A negative value disables the UV check (UV seams are welded).
+    void set_merge_uv_tolerance(double tolerance);
+
+    //! Get the maximum UV distance used for vertex welding
+    double get_merge_uv_tolerance() const;
+
+    //! Set whether faces are converted to arrays on multiple threads.
+    //! Each face writes to its own prefix-summed range of the output, so the result
+    //! is identical to serial extraction.
+    void set_parallel_extraction(bool parallel);
+
+    //! Get whether faces are converted to arrays on multiple threads
+    bool get_parallel_extraction() const;
+
+    //! Set the number of worker threads used for parallel extraction (0 = one per core)
+    void set_worker_count(int count);
+
+    //! Get the number of worker threads used for parallel extraction
+    int get_worker_count() const;
+
+    //! Weld duplicate vertices of an already extracted mesh data Dictionary
+    //! Uses the current merge tolerance, crease angle and UV tolerance settings.
+    //! Returns a new Dictionary with the same keys as extract_mesh_data
+    Dictionary merge_mesh_data(const Dictionary& mesh_data) const;
+
     //! Extract complete mesh data from a shape
     //! Returns a Dictionary with keys: "vertices", "triangles", "normals", "uvs"
     Dictionary extract_mesh_data(const Ref<ocgd_TopoDS_Shape>& shape, double linear_deflection = 0.1, double angular_deflection = 0.1, bool compute_normals = true);
@@ -182,7 +222,61 @@ public:
     //! Extract mesh data with specific mesh purpose
     Dictionary extract_mesh_data_with_purpose(const Ref<ocgd_TopoDS_Shape>& shape, double linear_deflection = 0.1, double angular_deflection = 0.1, int purpose = 0, bool compute_normals = true);
 
+    //! Extract the existing triangulation of a shape straight into packed arrays (C++ only).
+    //! Applies the include, merge and parallel settings like extract_mesh_data; normals and
+    //! uvs are left empty when not included. Does not triangulate the shape.
+    void extract_arrays(const TopoDS_Shape& shape, int purpose, PackedVector3Array& vertices,
+                        PackedInt32Array& triangles, PackedVector3Array& normals,
+                        PackedVector2Array& uvs) const;
+
+    //! Packed surface arrays of one face group, see extract_grouped_arrays
+    struct SurfaceArrays {
+        PackedVector3Array vertices;
+        PackedInt32Array triangles;
+        PackedVector3Array normals;
+        PackedVector2Array uvs;
+        //! (face index, first triangle, triangle count) per extracted face, in triangle order
+        PackedInt32Array face_ranges;
+    };
+
+    //! Extract the existing triangulation of a shape into one set of arrays per face group (C++ only).
+    //! face_groups maps each face (in TopExp_Explorer order) to an index into groups; faces
+    //! without or with an out-of-range entry go to group 0. groups must be sized by the caller.
+    void extract_grouped_arrays(const TopoDS_Shape& shape, int purpose, const std::vector<int>& face_groups,
+                                std::vector<SurfaceArrays>& groups) const;
+
 private:
+    //! Per-face work item of the two-pass mesh assembly: the face triangulation and
+    //! where its nodes and triangles go in the shared output arrays
+    struct FaceSlice {
+        TopoDS_Face face;
+        Handle(Poly_Triangulation) triangulation;
+        TopLoc_Location location;
+        int face_index = 0;
+        int node_offset = 0;
+        int triangle_offset = 0;
+        int written_triangles = 0;
+    };
+
+    //! Internal helper for the counting pass: collects valid face triangulations with their output offsets
+    void collect_face_slices(const TopoDS_Shape& shape, int purpose, std::vector<FaceSlice>& slices,
+                             int& total_nodes, int& total_triangles, bool& any_uvs) const;
+
+    //! Internal helper for the writing pass: allocates the output for laid out slices, writes all
+    //! faces, compacts skipped triangles, fills the face range table and welds vertices
+    void write_face_slices(std::vector<FaceSlice>& slices, int total_nodes, int total_triangles, bool any_uvs,
+                           PackedVector3Array& vertices, PackedInt32Array& triangles,
+                           PackedVector3Array& normals, PackedVector2Array& uvs,
+                           PackedInt32Array& face_ranges) const;
+
+    //! Internal helper for the writing pass: writes one face into its preallocated output ranges
+    //! Returns the number of triangles written (invalid triangles are skipped)
+    int write_face_slice(const FaceSlice& slice, Vector3* vertices, int32_t* triangles,
+                         Vector3* normals, Vector2* uvs) const;
+
+    //! Internal helper to close the gaps left by skipped triangles and shrink the index array
+    void compact_triangle_ranges(const std::vector<FaceSlice>& slices, PackedInt32Array& triangles) const;
+
     //! Internal helper to extract triangulation from a single face
     Handle(Poly_Triangulation) get_face_triangulation(const TopoDS_Face& face, int purpose = Poly_MeshPurpose_NONE) const;
 
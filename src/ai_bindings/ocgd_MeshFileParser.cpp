@@ -0,0 +1,1456 @@
+/**
+ * ocgd_MeshFileParser.cpp
+ *
+ * Memory-mapped, multithreaded OBJ, PLY and STL reader implementation.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_MeshFileParser.hxx"
+#include "ocgd_ParallelFor.hxx"
+
+#include <opencascade/BRep_Tool.hxx>
+#include <opencascade/TopExp_Explorer.hxx>
+#include <opencascade/TopoDS.hxx>
+#include <opencascade/TopoDS_Face.hxx>
+#include <opencascade/gp_Pnt.hxx>
+#include <opencascade/gp_Vec3f.hxx>
+#include <opencascade/Poly_Triangle.hxx>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Text is split into chunks of at least this size, a few per worker
+const size_t MIN_TEXT_CHUNK_SIZE = 1 << 20;
+const int TEXT_CHUNKS_PER_WORKER = 4;
+
+// Records (vertices, faces) converted per parallel work item
+const int64_t RECORD_BLOCK_SIZE = 1 << 16;
+
+// Read-only memory mapping of a whole file
+class ocgd_MappedFile {
+public:
+    ocgd_MappedFile() = default;
+    ocgd_MappedFile(const ocgd_MappedFile&) = delete;
+    ocgd_MappedFile& operator=(const ocgd_MappedFile&) = delete;
+
+    ~ocgd_MappedFile() {
+#ifdef _WIN32
+        if (_data != nullptr) {
+            UnmapViewOfFile(_data);
+        }
+        if (_mapping != nullptr) {
+            CloseHandle(_mapping);
+        }
+        if (_file != INVALID_HANDLE_VALUE) {
+            CloseHandle(_file);
+        }
+#else
+        if (_data != nullptr) {
+            munmap(const_cast<char*>(_data), _size);
+        }
+        if (_fd >= 0) {
+            ::close(_fd);
+        }
+#endif
+    }
+
+    bool open(const std::string& path, std::string& error) {
+#ifdef _WIN32
+        const int wide_size = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+        if (wide_size <= 1) {
+            error = "Invalid file path";
+            return false;
+        }
+        std::wstring wide_path(static_cast<size_t>(wide_size), L'\0');
+        MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, &wide_path[0], wide_size);
+
+        _file = CreateFileW(wide_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (_file == INVALID_HANDLE_VALUE) {
+            error = "Cannot open file";
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(_file, &size)) {
+            error = "Cannot query file size";
+            return false;
+        }
+        _size = static_cast<size_t>(size.QuadPart);
+        if (_size == 0) {
+            return true;
+        }
+
+        _mapping = CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (_mapping == nullptr) {
+            error = "Cannot map file into memory";
+            return false;
+        }
+        _data = static_cast<const char*>(MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (_data == nullptr) {
+            error = "Cannot map file into memory";
+            return false;
+        }
+        return true;
+#else
+        _fd = ::open(path.c_str(), O_RDONLY);
+        if (_fd < 0) {
+            error = "Cannot open file";
+            return false;
+        }
+
+        struct stat file_stat;
+        if (fstat(_fd, &file_stat) != 0) {
+            error = "Cannot query file size";
+            return false;
+        }
+        _size = static_cast<size_t>(file_stat.st_size);
+        if (_size == 0) {
+            return true;
+        }
+
+        void* mapped = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+        if (mapped == MAP_FAILED) {
+            error = "Cannot map file into memory";
+            return false;
+        }
+        _data = static_cast<const char*>(mapped);
+        // Chunks are read concurrently from all over the file, so ask for read-ahead of everything
+        madvise(mapped, _size, MADV_WILLNEED);
+        return true;
+#endif
+    }
+
+    const char* data() const { return _data; }
+    size_t size() const { return _size; }
+
+private:
+#ifdef _WIN32
+    HANDLE _file = INVALID_HANDLE_VALUE;
+    HANDLE _mapping = nullptr;
+#else
+    int _fd = -1;
+#endif
+    const char* _data = nullptr;
+    size_t _size = 0;
+};
+
+struct TextChunk {
+    const char* begin;
+    const char* end;
+};
+
+// Split [begin, end) into chunks that start at the beginning of a line
+std::vector<TextChunk> split_text(const char* begin, const char* end, int workers) {
+    const size_t size = static_cast<size_t>(end - begin);
+    const size_t max_chunks = static_cast<size_t>(workers) * TEXT_CHUNKS_PER_WORKER;
+    const size_t chunk_count = std::max<size_t>(1, std::min(size / MIN_TEXT_CHUNK_SIZE, max_chunks));
+
+    std::vector<TextChunk> chunks;
+    chunks.reserve(chunk_count);
+    const char* chunk_begin = begin;
+    for (size_t i = 1; i <= chunk_count && chunk_begin < end; i++) {
+        const char* chunk_end = end;
+        if (i < chunk_count) {
+            chunk_end = std::max(chunk_begin, begin + size / chunk_count * i);
+            const void* newline = std::memchr(chunk_end, '\n', static_cast<size_t>(end - chunk_end));
+            chunk_end = newline != nullptr ? static_cast<const char*>(newline) + 1 : end;
+        }
+        chunks.push_back({ chunk_begin, chunk_end });
+        chunk_begin = chunk_end;
+    }
+    return chunks;
+}
+
+// Run functor(first, last) over blocks of [0, count) in parallel
+template <typename Functor>
+void run_blocks(int64_t count, int worker_count, const Functor& functor) {
+    const int block_count = static_cast<int>((count + RECORD_BLOCK_SIZE - 1) / RECORD_BLOCK_SIZE);
+    ocgd_ParallelFor::run(block_count, worker_count, [&](int block) {
+        const int64_t first = static_cast<int64_t>(block) * RECORD_BLOCK_SIZE;
+        functor(first, std::min(count, first + RECORD_BLOCK_SIZE));
+    });
+}
+
+inline bool is_blank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline const char* skip_blanks(const char* p, const char* end) {
+    while (p < end && is_blank(*p)) {
+        ++p;
+    }
+    return p;
+}
+
+inline const char* next_line(const char* p, const char* end) {
+    const void* newline = std::memchr(p, '\n', static_cast<size_t>(end - p));
+    return newline != nullptr ? static_cast<const char*>(newline) + 1 : end;
+}
+
+inline bool at_line_end(const char* p, const char* end) {
+    return p >= end || *p == '\n' || *p == '#';
+}
+
+// Parse a decimal number at p (no locale, no allocation); returns false if there is none
+bool parse_number(const char*& p, const char* end, double& value) {
+    static const double POWERS_OF_TEN[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+')) {
+        negative = *s == '-';
+        ++s;
+    }
+
+    uint64_t mantissa = 0;
+    int significant_digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+
+    for (; s < end && is_digit(*s); ++s) {
+        has_digits = true;
+        if (significant_digits < 19) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+            if (mantissa != 0) {
+                significant_digits++;
+            }
+        } else {
+            exponent++;
+        }
+    }
+    if (s < end && *s == '.') {
+        for (++s; s < end && is_digit(*s); ++s) {
+            has_digits = true;
+            if (significant_digits < 19) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*s - '0');
+                if (mantissa != 0) {
+                    significant_digits++;
+                }
+                exponent--;
+            }
+        }
+    }
+    if (!has_digits) {
+        return false;
+    }
+
+    if (s < end && (*s == 'e' || *s == 'E')) {
+        const char* e = s + 1;
+        bool exponent_negative = false;
+        if (e < end && (*e == '-' || *e == '+')) {
+            exponent_negative = *e == '-';
+            ++e;
+        }
+        int exponent_value = 0;
+        bool has_exponent_digits = false;
+        for (; e < end && is_digit(*e); ++e) {
+            has_exponent_digits = true;
+            if (exponent_value < 10000) {
+                exponent_value = exponent_value * 10 + (*e - '0');
+            }
+        }
+        if (has_exponent_digits) {
+            exponent += exponent_negative ? -exponent_value : exponent_value;
+            s = e;
+        }
+    }
+
+    double result = static_cast<double>(mantissa);
+    if (exponent > 0) {
+        result *= exponent <= 22 ? POWERS_OF_TEN[exponent] : std::pow(10.0, exponent);
+    } else if (exponent < 0) {
+        result /= -exponent <= 22 ? POWERS_OF_TEN[-exponent] : std::pow(10.0, -exponent);
+    }
+
+    value = negative ? -result : result;
+    p = s;
+    return true;
+}
+
+bool parse_integer(const char*& p, const char* end, int64_t& value) {
+    const char* s = p;
+    bool negative = false;
+    if (s < end && (*s == '-' || *s == '+')) {
+        negative = *s == '-';
+        ++s;
+    }
+    if (s >= end || !is_digit(*s)) {
+        return false;
+    }
+    int64_t result = 0;
+    for (; s < end && is_digit(*s); ++s) {
+        if (result < (int64_t(1) << 48)) {
+            result = result * 10 + (*s - '0');
+        }
+    }
+    value = negative ? -result : result;
+    p = s;
+    return true;
+}
+
+// Parse up to count blank-separated numbers of the current line
+int parse_numbers(const char*& p, const char* end, float* values, int count) {
+    int parsed = 0;
+    double value;
+    while (parsed < count) {
+        p = skip_blanks(p, end);
+        if (!parse_number(p, end, value)) {
+            break;
+        }
+        values[parsed++] = static_cast<float>(value);
+    }
+    return parsed;
+}
+
+// Append a polygon as a triangle fan
+inline void append_fan(std::vector<int32_t>& triangles, const int32_t* corners, size_t corner_count) {
+    for (size_t i = 2; i < corner_count; i++) {
+        triangles.push_back(corners[0]);
+        triangles.push_back(corners[i - 1]);
+        triangles.push_back(corners[i]);
+    }
+}
+
+// Check that every triangle index refers to an existing vertex
+bool validate_indices(const ocgd_ParsedMesh& mesh, int worker_count) {
+    const int64_t vertex_count = mesh.vertex_count();
+    std::atomic<bool> valid(true);
+    run_blocks(static_cast<int64_t>(mesh.triangles.size()), worker_count, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++) {
+            if (mesh.triangles[i] < 0 || mesh.triangles[i] >= vertex_count) {
+                valid = false;
+                return;
+            }
+        }
+    });
+    return valid;
+}
+
+// === OBJ ===
+
+struct ObjChunk {
+    std::vector<float> positions;
+    std::vector<float> normals;
+    std::vector<int32_t> triangles;
+    // Entries of triangles written from negative (relative) indices, local to this chunk
+    std::vector<size_t> relative_slots;
+    // False once a corner has no normal or a normal index differing from its vertex index
+    bool normals_match = true;
+    // Relative normal indices only match if this chunk starts at equal v and vn counts
+    bool needs_equal_offsets = false;
+    std::string error;
+};
+
+void parse_obj_chunk(const TextChunk& text, ObjChunk& chunk) {
+    std::vector<int32_t> corners;
+    std::vector<bool> relative;
+    const char* end = text.end;
+    float values[3];
+
+    for (const char* line = text.begin; line < end; line = next_line(line, end)) {
+        const char* p = skip_blanks(line, end);
+        if (end - p < 2) {
+            continue;
+        }
+
+        if (p[0] == 'v' && is_blank(p[1])) {
+            p += 2;
+            if (parse_numbers(p, end, values, 3) != 3) {
+                chunk.error = "Invalid vertex record";
+                return;
+            }
+            chunk.positions.insert(chunk.positions.end(), values, values + 3);
+        } else if (p[0] == 'v' && p[1] == 'n' && end - p > 2 && is_blank(p[2])) {
+            p += 3;
+            if (parse_numbers(p, end, values, 3) != 3) {
+                chunk.error = "Invalid normal record";
+                return;
+            }
+            chunk.normals.insert(chunk.normals.end(), values, values + 3);
+        } else if (p[0] == 'f' && is_blank(p[1])) {
+            p += 2;
+            corners.clear();
+            const int64_t local_vertices = static_cast<int64_t>(chunk.positions.size() / 3);
+            const int64_t local_normals = static_cast<int64_t>(chunk.normals.size() / 3);
+            const size_t first_slot = chunk.triangles.size();
+            relative.clear();
+
+            for (p = skip_blanks(p, end); !at_line_end(p, end); p = skip_blanks(p, end)) {
+                int64_t vertex_index = 0;
+                if (!parse_integer(p, end, vertex_index) || vertex_index == 0) {
+                    chunk.error = "Invalid face record";
+                    return;
+                }
+
+                int64_t normal_index = 0;
+                if (p < end && *p == '/') {
+                    ++p;
+                    int64_t texture_index;
+                    parse_integer(p, end, texture_index);
+                    if (p < end && *p == '/') {
+                        ++p;
+                        parse_integer(p, end, normal_index);
+                    }
+                }
+                while (p < end && !is_blank(*p) && *p != '\n') {
+                    ++p;
+                }
+
+                if (normal_index != vertex_index) {
+                    chunk.normals_match = false;
+                } else if (vertex_index < 0) {
+                    chunk.needs_equal_offsets = true;
+                    if (local_vertices != local_normals) {
+                        chunk.normals_match = false;
+                    }
+                }
+
+                if (vertex_index > 0) {
+                    corners.push_back(static_cast<int32_t>(vertex_index - 1));
+                    relative.push_back(false);
+                } else {
+                    corners.push_back(static_cast<int32_t>(local_vertices + vertex_index));
+                    relative.push_back(true);
+                }
+            }
+
+            if (corners.size() < 3) {
+                continue;
+            }
+            append_fan(chunk.triangles, corners.data(), corners.size());
+
+            // Remember which fan entries still need the chunk's vertex offset
+            if (std::find(relative.begin(), relative.end(), true) != relative.end()) {
+                for (size_t i = 2; i < corners.size(); i++) {
+                    const size_t slot = first_slot + (i - 2) * 3;
+                    if (relative[0]) {
+                        chunk.relative_slots.push_back(slot);
+                    }
+                    if (relative[i - 1]) {
+                        chunk.relative_slots.push_back(slot + 1);
+                    }
+                    if (relative[i]) {
+                        chunk.relative_slots.push_back(slot + 2);
+                    }
+                }
+            }
+        }
+    }
+}
+
+// === PLY ===
+
+enum PlyType {
+    PLY_INVALID,
+    PLY_INT8,
+    PLY_UINT8,
+    PLY_INT16,
+    PLY_UINT16,
+    PLY_INT32,
+    PLY_UINT32,
+    PLY_FLOAT32,
+    PLY_FLOAT64
+};
+
+enum PlyFormat {
+    PLY_ASCII,
+    PLY_BINARY_LITTLE_ENDIAN,
+    PLY_BINARY_BIG_ENDIAN
+};
+
+struct PlyProperty {
+    std::string name;
+    PlyType type = PLY_INVALID;
+    bool is_list = false;
+    PlyType count_type = PLY_INVALID;
+};
+
+struct PlyElement {
+    std::string name;
+    int64_t count = 0;
+    std::vector<PlyProperty> properties;
+
+    int find_property(const char* property_name) const {
+        for (size_t i = 0; i < properties.size(); i++) {
+            if (properties[i].name == property_name) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+};
+
+struct PlyHeader {
+    PlyFormat format = PLY_ASCII;
+    std::vector<PlyElement> elements;
+    size_t body_offset = 0;
+};
+
+PlyType parse_ply_type(const std::string& name) {
+    if (name == "char" || name == "int8") return PLY_INT8;
+    if (name == "uchar" || name == "uint8") return PLY_UINT8;
+    if (name == "short" || name == "int16") return PLY_INT16;
+    if (name == "ushort" || name == "uint16") return PLY_UINT16;
+    if (name == "int" || name == "int32") return PLY_INT32;
+    if (name == "uint" || name == "uint32") return PLY_UINT32;
+    if (name == "float" || name == "float32") return PLY_FLOAT32;
+    if (name == "double" || name == "float64") return PLY_FLOAT64;
+    return PLY_INVALID;
+}
+
+inline int ply_type_size(PlyType type) {
+    switch (type) {
+        case PLY_INT8:
+        case PLY_UINT8:
+            return 1;
+        case PLY_INT16:
+        case PLY_UINT16:
+            return 2;
+        case PLY_INT32:
+        case PLY_UINT32:
+        case PLY_FLOAT32:
+            return 4;
+        case PLY_FLOAT64:
+            return 8;
+        default:
+            return 0;
+    }
+}
+
+// Decode one binary value in the given byte order, independent of the host byte order
+inline double read_ply_value(const uint8_t* p, PlyType type, bool big_endian) {
+    const int size = ply_type_size(type);
+    uint64_t bits = 0;
+    if (big_endian) {
+        for (int i = 0; i < size; i++) {
+            bits = (bits << 8) | p[i];
+        }
+    } else {
+        for (int i = size - 1; i >= 0; i--) {
+            bits = (bits << 8) | p[i];
+        }
+    }
+
+    switch (type) {
+        case PLY_INT8:
+            return static_cast<int8_t>(bits);
+        case PLY_UINT8:
+            return static_cast<uint8_t>(bits);
+        case PLY_INT16:
+            return static_cast<int16_t>(bits);
+        case PLY_UINT16:
+            return static_cast<uint16_t>(bits);
+        case PLY_INT32:
+            return static_cast<int32_t>(bits);
+        case PLY_UINT32:
+            return static_cast<uint32_t>(bits);
+        case PLY_FLOAT32: {
+            const uint32_t float_bits = static_cast<uint32_t>(bits);
+            float value;
+            std::memcpy(&value, &float_bits, sizeof(value));
+            return value;
+        }
+        case PLY_FLOAT64: {
+            double value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+        default:
+            return 0.0;
+    }
+}
+
+bool parse_ply_header(const char* data, size_t size, PlyHeader& header, std::string& error) {
+    const char* end = data + size;
+    const char* line = data;
+    bool has_format = false;
+
+    for (int line_number = 0; line < end; line_number++) {
+        const char* line_end = next_line(line, end);
+        std::string text(line, line_end);
+        while (!text.empty() && (text.back() == '\n' || text.back() == '\r' || is_blank(text.back()))) {
+            text.pop_back();
+        }
+
+        std::vector<std::string> words;
+        size_t position = 0;
+        while (position < text.size()) {
+            while (position < text.size() && is_blank(text[position])) {
+                position++;
+            }
+            const size_t word_begin = position;
+            while (position < text.size() && !is_blank(text[position])) {
+                position++;
+            }
+            if (position > word_begin) {
+                words.push_back(text.substr(word_begin, position - word_begin));
+            }
+        }
+        line = line_end;
+
+        if (line_number == 0) {
+            if (words.size() != 1 || words[0] != "ply") {
+                error = "Not a PLY file";
+                return false;
+            }
+            continue;
+        }
+        if (words.empty() || words[0] == "comment" || words[0] == "obj_info") {
+            continue;
+        }
+
+        if (words[0] == "format" && words.size() >= 2) {
+            if (words[1] == "ascii") {
+                header.format = PLY_ASCII;
+            } else if (words[1] == "binary_little_endian") {
+                header.format = PLY_BINARY_LITTLE_ENDIAN;
+            } else if (words[1] == "binary_big_endian") {
+                header.format = PLY_BINARY_BIG_ENDIAN;
+            } else {
+                error = "Unknown PLY format " + words[1];
+                return false;
+            }
+            has_format = true;
+        } else if (words[0] == "element" && words.size() == 3) {
+            PlyElement element;
+            element.name = words[1];
+            element.count = std::atoll(words[2].c_str());
+            if (element.count < 0) {
+                error = "Invalid PLY element count";
+                return false;
+            }
+            header.elements.push_back(element);
+        } else if (words[0] == "property" && !header.elements.empty()) {
+            PlyProperty property;
+            if (words.size() == 5 && words[1] == "list") {
+                property.is_list = true;
+                property.count_type = parse_ply_type(words[2]);
+                property.type = parse_ply_type(words[3]);
+                property.name = words[4];
+            } else if (words.size() == 3) {
+                property.type = parse_ply_type(words[1]);
+                property.name = words[2];
+            }
+            if (property.type == PLY_INVALID || (property.is_list && property.count_type == PLY_INVALID)) {
+                error = "Invalid PLY property: " + text;
+                return false;
+            }
+            header.elements.back().properties.push_back(property);
+        } else if (words[0] == "end_header") {
+            if (!has_format) {
+                error = "PLY header has no format";
+                return false;
+            }
+            header.body_offset = static_cast<size_t>(line - data);
+            return true;
+        } else {
+            error = "Invalid PLY header line: " + text;
+            return false;
+        }
+    }
+
+    error = "PLY header has no end_header";
+    return false;
+}
+
+// Where the mesh data lives in the vertex and face elements
+struct PlyLayout {
+    int vertex_element = -1;
+    int face_element = -1;
+    int position_properties[3] = { -1, -1, -1 };
+    int normal_properties[3] = { -1, -1, -1 };
+    int index_property = -1;
+
+    bool has_normals() const {
+        return normal_properties[0] >= 0 && normal_properties[1] >= 0 && normal_properties[2] >= 0;
+    }
+};
+
+bool find_ply_layout(const PlyHeader& header, PlyLayout& layout, std::string& error) {
+    for (size_t i = 0; i < header.elements.size(); i++) {
+        const PlyElement& element = header.elements[i];
+        if (element.name == "vertex") {
+            layout.vertex_element = static_cast<int>(i);
+            const char* position_names[3] = { "x", "y", "z" };
+            const char* normal_names[3] = { "nx", "ny", "nz" };
+            for (int k = 0; k < 3; k++) {
+                layout.position_properties[k] = element.find_property(position_names[k]);
+                layout.normal_properties[k] = element.find_property(normal_names[k]);
+            }
+        } else if (element.name == "face") {
+            layout.face_element = static_cast<int>(i);
+            layout.index_property = element.find_property("vertex_indices");
+            if (layout.index_property < 0) {
+                layout.index_property = element.find_property("vertex_index");
+            }
+        }
+    }
+
+    if (layout.vertex_element < 0 || layout.position_properties[0] < 0
+        || layout.position_properties[1] < 0 || layout.position_properties[2] < 0) {
+        error = "PLY file has no vertex positions";
+        return false;
+    }
+    if (header.elements[layout.vertex_element].count > INT32_MAX) {
+        error = "Too many PLY vertices";
+        return false;
+    }
+    if (layout.face_element < 0 || layout.index_property < 0
+        || !header.elements[layout.face_element].properties[layout.index_property].is_list) {
+        error = "PLY file has no faces";
+        return false;
+    }
+    return true;
+}
+
+// Size of a binary record, or 0 if the element has list properties
+int64_t ply_fixed_record_size(const PlyElement& element) {
+    int64_t size = 0;
+    for (const PlyProperty& property : element.properties) {
+        if (property.is_list) {
+            return 0;
+        }
+        size += ply_type_size(property.type);
+    }
+    return size;
+}
+
+// Size of one binary record starting at p, or 0 if it runs past end
+int64_t ply_record_size(const PlyElement& element, const uint8_t* p, const uint8_t* end, bool big_endian) {
+    const uint8_t* s = p;
+    for (const PlyProperty& property : element.properties) {
+        if (property.is_list) {
+            const int count_size = ply_type_size(property.count_type);
+            if (end - s < count_size) {
+                return 0;
+            }
+            const double count = read_ply_value(s, property.count_type, big_endian);
+            if (count < 0) {
+                return 0;
+            }
+            s += count_size;
+            const int64_t items_size = static_cast<int64_t>(count) * ply_type_size(property.type);
+            if (end - s < items_size) {
+                return 0;
+            }
+            s += items_size;
+        } else {
+            const int size = ply_type_size(property.type);
+            if (end - s < size) {
+                return 0;
+            }
+            s += size;
+        }
+    }
+    return s - p;
+}
+
+// Byte offset of each scalar property within a fixed-size record
+std::vector<int64_t> ply_property_offsets(const PlyElement& element) {
+    std::vector<int64_t> offsets;
+    int64_t offset = 0;
+    for (const PlyProperty& property : element.properties) {
+        offsets.push_back(offset);
+        offset += ply_type_size(property.type);
+    }
+    return offsets;
+}
+
+void read_ply_face_list(const uint8_t* p, const PlyProperty& property, bool big_endian,
+                        std::vector<int32_t>& corners, std::vector<int32_t>& triangles) {
+    const int64_t count = static_cast<int64_t>(read_ply_value(p, property.count_type, big_endian));
+    const int item_size = ply_type_size(property.type);
+    p += ply_type_size(property.count_type);
+    corners.clear();
+    for (int64_t i = 0; i < count; i++, p += item_size) {
+        corners.push_back(static_cast<int32_t>(read_ply_value(p, property.type, big_endian)));
+    }
+    append_fan(triangles, corners.data(), corners.size());
+}
+
+bool parse_ply_binary(const char* data, size_t size, const PlyHeader& header, const PlyLayout& layout,
+                      int worker_count, ocgd_ParsedMesh& mesh, std::string& error) {
+    const bool big_endian = header.format == PLY_BINARY_BIG_ENDIAN;
+    const uint8_t* body = reinterpret_cast<const uint8_t*>(data) + header.body_offset;
+    const uint8_t* end = reinterpret_cast<const uint8_t*>(data) + size;
+    const uint8_t* cursor = body;
+
+    for (int e = 0; e <= layout.face_element || e <= layout.vertex_element; e++) {
+        const PlyElement& element = header.elements[e];
+        const int64_t record_size = ply_fixed_record_size(element);
+
+        if (e == layout.vertex_element) {
+            if (record_size == 0) {
+                error = "PLY vertex element with list properties is not supported";
+                return false;
+            }
+            if ((end - cursor) / record_size < element.count) {
+                error = "PLY file is truncated";
+                return false;
+            }
+
+            // Decoded straight from the mapped file, in parallel blocks
+            const std::vector<int64_t> offsets = ply_property_offsets(element);
+            const bool with_normals = layout.has_normals();
+            mesh.positions.resize(static_cast<size_t>(element.count) * 3);
+            if (with_normals) {
+                mesh.normals.resize(static_cast<size_t>(element.count) * 3);
+            }
+            const uint8_t* records = cursor;
+            run_blocks(element.count, worker_count, [&](int64_t first, int64_t last) {
+                for (int64_t i = first; i < last; i++) {
+                    const uint8_t* record = records + i * record_size;
+                    for (int k = 0; k < 3; k++) {
+                        const PlyProperty& position = element.properties[layout.position_properties[k]];
+                        mesh.positions[i * 3 + k] = static_cast<float>(read_ply_value(record + offsets[layout.position_properties[k]], position.type, big_endian));
+                        if (with_normals) {
+                            const PlyProperty& normal = element.properties[layout.normal_properties[k]];
+                            mesh.normals[i * 3 + k] = static_cast<float>(read_ply_value(record + offsets[layout.normal_properties[k]], normal.type, big_endian));
+                        }
+                    }
+                }
+            });
+            cursor += element.count * record_size;
+            continue;
+        }
+
+        if (e == layout.face_element) {
+            const PlyProperty& index_property = element.properties[layout.index_property];
+            const int count_size = ply_type_size(index_property.count_type);
+            const int index_size = ply_type_size(index_property.type);
+
+            // Fast path: when the index list is the only list, assume triangles everywhere so
+            // records have a fixed stride, and verify the assumption while decoding in parallel
+            bool only_index_list = true;
+            int64_t triangle_record_size = 0;
+            int64_t index_offset = 0;
+            for (size_t k = 0; k < element.properties.size(); k++) {
+                const PlyProperty& property = element.properties[k];
+                if (static_cast<int>(k) == layout.index_property) {
+                    index_offset = triangle_record_size;
+                    triangle_record_size += count_size + 3 * index_size;
+                } else if (property.is_list) {
+                    only_index_list = false;
+                } else {
+                    triangle_record_size += ply_type_size(property.type);
+                }
+            }
+
+            if (only_index_list && (end - cursor) / triangle_record_size >= element.count) {
+                std::atomic<bool> all_triangles(true);
+                mesh.triangles.resize(static_cast<size_t>(element.count) * 3);
+                const uint8_t* records = cursor;
+                run_blocks(element.count, worker_count, [&](int64_t first, int64_t last) {
+                    for (int64_t i = first; i < last && all_triangles; i++) {
+                        const uint8_t* list = records + i * triangle_record_size + index_offset;
+                        if (read_ply_value(list, index_property.count_type, big_endian) != 3.0) {
+                            all_triangles = false;
+                            return;
+                        }
+                        for (int k = 0; k < 3; k++) {
+                            mesh.triangles[i * 3 + k] = static_cast<int32_t>(read_ply_value(list + count_size + k * index_size, index_property.type, big_endian));
+                        }
+                    }
+                });
+                if (all_triangles) {
+                    cursor += element.count * triangle_record_size;
+                    continue;
+                }
+                mesh.triangles.clear();
+            }
+
+            // General case: polygons of any size, decoded sequentially
+            std::vector<int32_t> corners;
+            for (int64_t i = 0; i < element.count; i++) {
+                const int64_t current_size = ply_record_size(element, cursor, end, big_endian);
+                if (current_size == 0) {
+                    error = "PLY file is truncated";
+                    return false;
+                }
+                const uint8_t* p = cursor;
+                for (size_t k = 0; k < element.properties.size(); k++) {
+                    const PlyProperty& property = element.properties[k];
+                    if (static_cast<int>(k) == layout.index_property) {
+                        read_ply_face_list(p, property, big_endian, corners, mesh.triangles);
+                    }
+                    if (property.is_list) {
+                        const int64_t count = static_cast<int64_t>(read_ply_value(p, property.count_type, big_endian));
+                        p += ply_type_size(property.count_type) + count * ply_type_size(property.type);
+                    } else {
+                        p += ply_type_size(property.type);
+                    }
+                }
+                cursor += current_size;
+            }
+            continue;
+        }
+
+        // Some other element before the ones we need: skip it
+        if (record_size > 0) {
+            if ((end - cursor) / record_size < element.count) {
+                error = "PLY file is truncated";
+                return false;
+            }
+            cursor += element.count * record_size;
+        } else {
+            for (int64_t i = 0; i < element.count; i++) {
+                const int64_t current_size = ply_record_size(element, cursor, end, big_endian);
+                if (current_size == 0) {
+                    error = "PLY file is truncated";
+                    return false;
+                }
+                cursor += current_size;
+            }
+        }
+    }
+    return true;
+}
+
+// Values of one ASCII record; lists are stored as their count followed by their items
+bool parse_ply_ascii_record(const char*& p, const char* end, const PlyElement& element,
+                            int wanted_list, std::vector<double>& scalars, std::vector<int32_t>& list) {
+    scalars.clear();
+    list.clear();
+    double value;
+    for (size_t k = 0; k < element.properties.size(); k++) {
+        p = skip_blanks(p, end);
+        if (!parse_number(p, end, value)) {
+            return false;
+        }
+        if (!element.properties[k].is_list) {
+            scalars.push_back(value);
+            continue;
+        }
+        scalars.push_back(0.0);
+        const int64_t count = static_cast<int64_t>(value);
+        for (int64_t i = 0; i < count; i++) {
+            p = skip_blanks(p, end);
+            if (!parse_number(p, end, value)) {
+                return false;
+            }
+            if (static_cast<int>(k) == wanted_list) {
+                list.push_back(static_cast<int32_t>(value));
+            }
+        }
+    }
+    return true;
+}
+
+bool parse_ply_ascii(const char* data, size_t size, const PlyHeader& header, const PlyLayout& layout,
+                     int worker_count, ocgd_ParsedMesh& mesh, std::string& error) {
+    // One record per non-empty line; element e covers lines [first_line[e], first_line[e + 1])
+    std::vector<int64_t> first_line(header.elements.size() + 1, 0);
+    for (size_t e = 0; e < header.elements.size(); e++) {
+        first_line[e + 1] = first_line[e] + header.elements[e].count;
+    }
+    const PlyElement& vertex_element = header.elements[layout.vertex_element];
+    const PlyElement& face_element = header.elements[layout.face_element];
+    const int64_t vertex_begin = first_line[layout.vertex_element];
+    const int64_t face_begin = first_line[layout.face_element];
+
+    const int workers = ocgd_ParallelFor::resolve_worker_count(worker_count);
+    const std::vector<TextChunk> chunks = split_text(data + header.body_offset, data + size, workers);
+    const int chunk_count = static_cast<int>(chunks.size());
+
+    // Pass 1: count records per chunk to find the global record index each chunk starts at
+    std::vector<int64_t> chunk_lines(chunks.size() + 1, 0);
+    ocgd_ParallelFor::run(chunk_count, worker_count, [&](int c) {
+        int64_t lines = 0;
+        for (const char* line = chunks[c].begin; line < chunks[c].end; line = next_line(line, chunks[c].end)) {
+            const char* p = skip_blanks(line, chunks[c].end);
+            if (p < chunks[c].end && *p != '\n') {
+                lines++;
+            }
+        }
+        chunk_lines[c + 1] = lines;
+    });
+    for (int c = 0; c < chunk_count; c++) {
+        chunk_lines[c + 1] += chunk_lines[c];
+    }
+    if (chunk_lines[chunk_count] < first_line[std::max(layout.vertex_element, layout.face_element) + 1]) {
+        error = "PLY file is truncated";
+        return false;
+    }
+
+    // Pass 2: vertices go straight to their slot, face triangles are gathered per chunk
+    const bool with_normals = layout.has_normals();
+    mesh.positions.resize(static_cast<size_t>(vertex_element.count) * 3);
+    if (with_normals) {
+        mesh.normals.resize(static_cast<size_t>(vertex_element.count) * 3);
+    }
+    std::vector<std::vector<int32_t>> chunk_triangles(chunks.size());
+    std::vector<std::string> chunk_errors(chunks.size());
+
+    ocgd_ParallelFor::run(chunk_count, worker_count, [&](int c) {
+        std::vector<double> scalars;
+        std::vector<int32_t> list;
+        int64_t record = chunk_lines[c];
+        const char* end = chunks[c].end;
+
+        for (const char* line = chunks[c].begin; line < end; line = next_line(line, end)) {
+            const char* p = skip_blanks(line, end);
+            if (p >= end || *p == '\n') {
+                continue;
+            }
+            const int64_t index = record++;
+
+            if (index >= vertex_begin && index < vertex_begin + vertex_element.count) {
+                if (!parse_ply_ascii_record(p, end, vertex_element, -1, scalars, list)) {
+                    chunk_errors[c] = "Invalid PLY vertex record";
+                    return;
+                }
+                const int64_t vertex = index - vertex_begin;
+                for (int k = 0; k < 3; k++) {
+                    mesh.positions[vertex * 3 + k] = static_cast<float>(scalars[layout.position_properties[k]]);
+                    if (with_normals) {
+                        mesh.normals[vertex * 3 + k] = static_cast<float>(scalars[layout.normal_properties[k]]);
+                    }
+                }
+            } else if (index >= face_begin && index < face_begin + face_element.count) {
+                if (!parse_ply_ascii_record(p, end, face_element, layout.index_property, scalars, list)) {
+                    chunk_errors[c] = "Invalid PLY face record";
+                    return;
+                }
+                append_fan(chunk_triangles[c], list.data(), list.size());
+            }
+        }
+    });
+
+    for (int c = 0; c < chunk_count; c++) {
+        if (!chunk_errors[c].empty()) {
+            error = chunk_errors[c];
+            return false;
+        }
+    }
+
+    size_t triangle_size = 0;
+    for (const std::vector<int32_t>& triangles : chunk_triangles) {
+        triangle_size += triangles.size();
+    }
+    mesh.triangles.reserve(triangle_size);
+    for (const std::vector<int32_t>& triangles : chunk_triangles) {
+        mesh.triangles.insert(mesh.triangles.end(), triangles.begin(), triangles.end());
+    }
+    return true;
+}
+
+// === STL ===
+
+// Binary STL layout: 80 byte header, uint32 triangle count, then 50 bytes per triangle
+// (normal, three corners, attribute byte count)
+const int64_t STL_BINARY_HEADER_SIZE = 84;
+const int64_t STL_BINARY_TRIANGLE_SIZE = 50;
+
+inline float load_float_le(const uint8_t* p) {
+    const uint32_t bits = static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8)
+        | (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Hash of a corner position; -0.0 and 0.0 hash alike since they compare equal
+inline uint64_t hash_position(const float* position) {
+    uint64_t hash = 0;
+    for (int k = 0; k < 3; k++) {
+        const float value = position[k] + 0.0f;
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hash = (hash ^ bits) * 0x9E3779B97F4A7C15ull;
+        hash ^= hash >> 29;
+    }
+    return hash;
+}
+
+inline bool same_position(const float* a, const float* b) {
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+// Merge corners with identical positions into shared vertices. Corners are split into
+// shards by hash; every shard welds its corners into its own open-addressing table in
+// corner order, so the result does not depend on thread scheduling.
+void weld_corners(const std::vector<float>& corners, int worker_count, ocgd_ParsedMesh& mesh) {
+    const int64_t corner_count = static_cast<int64_t>(corners.size() / 3);
+    const int workers = ocgd_ParallelFor::resolve_worker_count(worker_count);
+    const uint64_t shard_count = workers == 1 ? 1 : static_cast<uint64_t>(workers) * 2;
+    const int64_t block_count = (corner_count + RECORD_BLOCK_SIZE - 1) / RECORD_BLOCK_SIZE;
+
+    // Hash the corners and count them per (block, shard)
+    std::vector<uint64_t> hashes(static_cast<size_t>(corner_count));
+    std::vector<int64_t> block_offsets(static_cast<size_t>(block_count) * shard_count, 0);
+    run_blocks(corner_count, worker_count, [&](int64_t first, int64_t last) {
+        int64_t* counts = &block_offsets[static_cast<size_t>(first / RECORD_BLOCK_SIZE) * shard_count];
+        for (int64_t i = first; i < last; i++) {
+            hashes[i] = hash_position(&corners[i * 3]);
+            counts[hashes[i] % shard_count]++;
+        }
+    });
+
+    // Stable counting sort of corner indices by shard: the prefix sums run shard-major, so each
+    // shard's bucket lists its corners in increasing order and a shard only walks its own bucket
+    std::vector<int64_t> shard_starts(shard_count + 1, 0);
+    int64_t bucket_offset = 0;
+    for (uint64_t shard = 0; shard < shard_count; shard++) {
+        shard_starts[shard] = bucket_offset;
+        for (int64_t block = 0; block < block_count; block++) {
+            int64_t& offset = block_offsets[static_cast<size_t>(block) * shard_count + shard];
+            const int64_t count = offset;
+            offset = bucket_offset;
+            bucket_offset += count;
+        }
+    }
+    shard_starts[shard_count] = bucket_offset;
+
+    std::vector<int32_t> buckets(static_cast<size_t>(corner_count));
+    run_blocks(corner_count, worker_count, [&](int64_t first, int64_t last) {
+        int64_t* offsets = &block_offsets[static_cast<size_t>(first / RECORD_BLOCK_SIZE) * shard_count];
+        for (int64_t i = first; i < last; i++) {
+            buckets[offsets[hashes[i] % shard_count]++] = static_cast<int32_t>(i);
+        }
+    });
+
+    std::vector<int32_t> local_index(static_cast<size_t>(corner_count));
+    std::vector<std::vector<int32_t>> shard_vertices(shard_count);
+    ocgd_ParallelFor::run(static_cast<int>(shard_count), worker_count, [&](int shard) {
+        const int64_t bucket_first = shard_starts[shard];
+        const int64_t bucket_last = shard_starts[shard + 1];
+
+        size_t table_size = 16;
+        while (table_size < static_cast<size_t>(bucket_last - bucket_first) * 2) {
+            table_size <<= 1;
+        }
+        const size_t mask = table_size - 1;
+        std::vector<int32_t> table(table_size, -1);
+        std::vector<int32_t>& vertices = shard_vertices[shard];
+
+        for (int64_t k = bucket_first; k < bucket_last; k++) {
+            const int32_t i = buckets[k];
+            const uint64_t hash = hashes[i];
+            // High bits pick the slot, low bits already picked the shard
+            for (size_t slot = static_cast<size_t>(hash >> 32) & mask;; slot = (slot + 1) & mask) {
+                const int32_t first = table[slot];
+                if (first < 0) {
+                    table[slot] = i;
+                    local_index[i] = static_cast<int32_t>(vertices.size());
+                    vertices.push_back(i);
+                    break;
+                }
+                if (hashes[first] == hash && same_position(&corners[static_cast<size_t>(first) * 3],
+                                                           &corners[static_cast<size_t>(i) * 3])) {
+                    local_index[i] = local_index[first];
+                    break;
+                }
+            }
+        }
+    });
+
+    std::vector<int64_t> shard_offsets(shard_count + 1, 0);
+    for (uint64_t shard = 0; shard < shard_count; shard++) {
+        shard_offsets[shard + 1] = shard_offsets[shard] + static_cast<int64_t>(shard_vertices[shard].size());
+    }
+
+    mesh.positions.resize(static_cast<size_t>(shard_offsets[shard_count]) * 3);
+    mesh.normals.clear();
+    ocgd_ParallelFor::run(static_cast<int>(shard_count), worker_count, [&](int shard) {
+        float* destination = &mesh.positions[static_cast<size_t>(shard_offsets[shard]) * 3];
+        for (int32_t corner : shard_vertices[shard]) {
+            std::memcpy(destination, &corners[static_cast<size_t>(corner) * 3], 3 * sizeof(float));
+            destination += 3;
+        }
+    });
+
+    mesh.triangles.resize(static_cast<size_t>(corner_count));
+    run_blocks(corner_count, worker_count, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++) {
+            mesh.triangles[i] = static_cast<int32_t>(shard_offsets[hashes[i] % shard_count] + local_index[i]);
+        }
+    });
+}
+
+// Collect the corners of all "vertex" records of an ASCII STL chunk
+void parse_stl_ascii_chunk(const TextChunk& text, std::vector<float>& corners, std::string& error) {
+    const char* end = text.end;
+    float values[3];
+    for (const char* line = text.begin; line < end; line = next_line(line, end)) {
+        const char* p = skip_blanks(line, end);
+        if (end - p < 7 || std::memcmp(p, "vertex", 6) != 0 || !is_blank(p[6])) {
+            continue;
+        }
+        p += 7;
+        if (parse_numbers(p, end, values, 3) != 3) {
+            error = "Invalid STL vertex record";
+            return;
+        }
+        corners.insert(corners.end(), values, values + 3);
+    }
+}
+
+} // namespace
+
+bool ocgd_MeshFileParser::parse_obj(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error) {
+    ocgd_MappedFile file;
+    if (!file.open(path, error)) {
+        return false;
+    }
+    if (file.size() == 0) {
+        error = "OBJ file is empty";
+        return false;
+    }
+
+    const int workers = ocgd_ParallelFor::resolve_worker_count(worker_count);
+    const std::vector<TextChunk> text_chunks = split_text(file.data(), file.data() + file.size(), workers);
+    const int chunk_count = static_cast<int>(text_chunks.size());
+
+    std::vector<ObjChunk> chunks(text_chunks.size());
+    ocgd_ParallelFor::run(chunk_count, worker_count, [&](int c) {
+        parse_obj_chunk(text_chunks[c], chunks[c]);
+    });
+
+    // Prefix sums give every chunk its place in the merged arrays
+    std::vector<size_t> position_offsets(chunks.size() + 1, 0);
+    std::vector<size_t> normal_offsets(chunks.size() + 1, 0);
+    std::vector<size_t> triangle_offsets(chunks.size() + 1, 0);
+    bool normals_match = true;
+    for (int c = 0; c < chunk_count; c++) {
+        if (!chunks[c].error.empty()) {
+            error = chunks[c].error;
+            return false;
+        }
+        position_offsets[c + 1] = position_offsets[c] + chunks[c].positions.size();
+        normal_offsets[c + 1] = normal_offsets[c] + chunks[c].normals.size();
+        triangle_offsets[c + 1] = triangle_offsets[c] + chunks[c].triangles.size();
+        normals_match = normals_match && chunks[c].normals_match
+            && (!chunks[c].needs_equal_offsets || position_offsets[c] == normal_offsets[c]);
+    }
+    normals_match = normals_match && normal_offsets[chunk_count] == position_offsets[chunk_count];
+
+    if (position_offsets[chunk_count] / 3 > static_cast<size_t>(INT32_MAX)) {
+        error = "Too many OBJ vertices";
+        return false;
+    }
+    if (triangle_offsets[chunk_count] == 0) {
+        error = "OBJ file has no faces";
+        return false;
+    }
+
+    mesh.positions.resize(position_offsets[chunk_count]);
+    mesh.normals.resize(normals_match ? normal_offsets[chunk_count] : 0);
+    mesh.triangles.resize(triangle_offsets[chunk_count]);
+
+    ocgd_ParallelFor::run(chunk_count, worker_count, [&](int c) {
+        ObjChunk& chunk = chunks[c];
+        std::copy(chunk.positions.begin(), chunk.positions.end(), mesh.positions.begin() + position_offsets[c]);
+        if (normals_match) {
+            std::copy(chunk.normals.begin(), chunk.normals.end(), mesh.normals.begin() + normal_offsets[c]);
+        }
+
+        const int32_t vertex_offset = static_cast<int32_t>(position_offsets[c] / 3);
+        for (size_t slot : chunk.relative_slots) {
+            chunk.triangles[slot] += vertex_offset;
+        }
+        std::copy(chunk.triangles.begin(), chunk.triangles.end(), mesh.triangles.begin() + triangle_offsets[c]);
+
+        // Release chunk memory as soon as it is merged
+        std::vector<float>().swap(chunk.positions);
+        std::vector<float>().swap(chunk.normals);
+        std::vector<int32_t>().swap(chunk.triangles);
+    });
+
+    if (!validate_indices(mesh, worker_count)) {
+        error = "OBJ face refers to a missing vertex";
+        return false;
+    }
+    return true;
+}
+
+bool ocgd_MeshFileParser::parse_ply(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error) {
+    ocgd_MappedFile file;
+    if (!file.open(path, error)) {
+        return false;
+    }
+    if (file.size() == 0) {
+        error = "PLY file is empty";
+        return false;
+    }
+
+    PlyHeader header;
+    if (!parse_ply_header(file.data(), file.size(), header, error)) {
+        return false;
+    }
+    PlyLayout layout;
+    if (!find_ply_layout(header, layout, error)) {
+        return false;
+    }
+
+    const bool parsed = header.format == PLY_ASCII
+        ? parse_ply_ascii(file.data(), file.size(), header, layout, worker_count, mesh, error)
+        : parse_ply_binary(file.data(), file.size(), header, layout, worker_count, mesh, error);
+    if (!parsed) {
+        return false;
+    }
+
+    if (mesh.triangles.empty()) {
+        error = "PLY file has no faces";
+        return false;
+    }
+    if (!validate_indices(mesh, worker_count)) {
+        error = "PLY face refers to a missing vertex";
+        return false;
+    }
+    return true;
+}
+
+bool ocgd_MeshFileParser::parse_stl(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error) {
+    ocgd_MappedFile file;
+    if (!file.open(path, error)) {
+        return false;
+    }
+    if (file.size() == 0) {
+        error = "STL file is empty";
+        return false;
+    }
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(file.data());
+    const int64_t size = static_cast<int64_t>(file.size());
+
+    // Binary files are recognized by their exact size, as their header may start with "solid" too
+    int64_t binary_triangles = -1;
+    if (size >= STL_BINARY_HEADER_SIZE) {
+        binary_triangles = static_cast<int64_t>(data[80]) | (static_cast<int64_t>(data[81]) << 8)
+            | (static_cast<int64_t>(data[82]) << 16) | (static_cast<int64_t>(data[83]) << 24);
+    }
+    const bool binary = binary_triangles >= 0
+        && size == STL_BINARY_HEADER_SIZE + binary_triangles * STL_BINARY_TRIANGLE_SIZE;
+
+    std::vector<float> corners;
+    if (binary) {
+        corners.resize(static_cast<size_t>(binary_triangles) * 9);
+        const uint8_t* records = data + STL_BINARY_HEADER_SIZE;
+        run_blocks(binary_triangles, worker_count, [&](int64_t first, int64_t last) {
+            for (int64_t i = first; i < last; i++) {
+                // Skip the facet normal, read the three corners
+                const uint8_t* record = records + i * STL_BINARY_TRIANGLE_SIZE + 12;
+                for (int k = 0; k < 9; k++) {
+                    corners[i * 9 + k] = load_float_le(record + k * 4);
+                }
+            }
+        });
+    } else {
+        const char* text = file.data();
+        const char* text_end = text + size;
+        const char* start = skip_blanks(text, text_end);
+        if (text_end - start < 5 || std::memcmp(start, "solid", 5) != 0) {
+            error = "Not an STL file or binary STL file is truncated";
+            return false;
+        }
+
+        const int workers = ocgd_ParallelFor::resolve_worker_count(worker_count);
+        const std::vector<TextChunk> chunks = split_text(text, text_end, workers);
+        const int chunk_count = static_cast<int>(chunks.size());
+        std::vector<std::vector<float>> chunk_corners(chunks.size());
+        std::vector<std::string> chunk_errors(chunks.size());
+        ocgd_ParallelFor::run(chunk_count, worker_count, [&](int c) {
+            parse_stl_ascii_chunk(chunks[c], chunk_corners[c], chunk_errors[c]);
+        });
+
+        size_t corner_size = 0;
+        for (int c = 0; c < chunk_count; c++) {
+            if (!chunk_errors[c].empty()) {
+                error = chunk_errors[c];
+                return false;
+            }
+            corner_size += chunk_corners[c].size();
+        }
+        corners.reserve(corner_size);
+        for (std::vector<float>& chunk : chunk_corners) {
+            corners.insert(corners.end(), chunk.begin(), chunk.end());
+            std::vector<float>().swap(chunk);
+        }
+        if (corners.size() % 9 != 0) {
+            error = "STL facet does not have three vertices";
+            return false;
+        }
+    }
+
+    if (corners.empty()) {
+        error = "STL file has no triangles";
+        return false;
+    }
+    if (corners.size() / 3 > static_cast<size_t>(INT32_MAX)) {
+        error = "Too many STL triangles";
+        return false;
+    }
+
+    weld_corners(corners, worker_count, mesh);
+    return true;
+}
+
+Handle(Poly_Triangulation) ocgd_MeshFileParser::to_triangulation(const ocgd_ParsedMesh& mesh, int worker_count) {
+    const int64_t vertex_count = mesh.vertex_count();
+    const int64_t triangle_count = mesh.triangle_count();
+    if (vertex_count == 0 || triangle_count == 0 || triangle_count > INT32_MAX) {
+        return Handle(Poly_Triangulation)();
+    }
+
+    const bool with_normals = mesh.normals.size() == mesh.positions.size();
+    Handle(Poly_Triangulation) triangulation = new Poly_Triangulation(
+        static_cast<Standard_Integer>(vertex_count), static_cast<Standard_Integer>(triangle_count),
+        Standard_False, with_normals ? Standard_True : Standard_False);
+
+    // Distinct indices touch distinct array entries, so blocks can be filled concurrently
+    run_blocks(vertex_count, worker_count, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++) {
+            const float* p = &mesh.positions[i * 3];
+            triangulation->SetNode(static_cast<Standard_Integer>(i + 1), gp_Pnt(p[0], p[1], p[2]));
+            if (with_normals) {
+                const float* n = &mesh.normals[i * 3];
+                triangulation->SetNormal(static_cast<Standard_Integer>(i + 1), gp_Vec3f(n[0], n[1], n[2]));
+            }
+        }
+    });
+    run_blocks(triangle_count, worker_count, [&](int64_t first, int64_t last) {
+        for (int64_t i = first; i < last; i++) {
+            const int32_t* t = &mesh.triangles[i * 3];
+            triangulation->SetTriangle(static_cast<Standard_Integer>(i + 1), Poly_Triangle(t[0] + 1, t[1] + 1, t[2] + 1));
+        }
+    });
+
+    return triangulation;
+}
+
+bool ocgd_MeshFileParser::is_mesh_only(const TopoDS_Shape& shape) {
+    bool has_faces = false;
+    for (TopExp_Explorer face_explorer(shape, TopAbs_FACE); face_explorer.More(); face_explorer.Next()) {
+        TopLoc_Location location;
+        if (!BRep_Tool::Surface(TopoDS::Face(face_explorer.Current()), location).IsNull()) {
+            return false;
+        }
+        has_faces = true;
+    }
+    return has_faces;
+}
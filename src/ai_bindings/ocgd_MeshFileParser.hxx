@@ -0,0 +1,78 @@
+/**
+ * ocgd_MeshFileParser.hxx
+ *
+ * Internal helper to read triangle meshes from Wavefront OBJ, Stanford PLY (ASCII,
+ * binary_little_endian and binary_big_endian) and STL (ASCII and binary) files.
+ *
+ * Files are memory-mapped rather than streamed: the body is split into chunks that are
+ * parsed concurrently with ocgd_ParallelFor, and binary PLY records are decoded straight
+ * from the mapped pages without an intermediate read buffer.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_MeshFileParser_HeaderFile
+#define _ocgd_MeshFileParser_HeaderFile
+
+#include <opencascade/Poly_Triangulation.hxx>
+#include <opencascade/TopoDS_Shape.hxx>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Triangle mesh in flat arrays, as read from a mesh file.
+ *
+ * Triangles keep the file's counter-clockwise winding; polygons are fan-triangulated.
+ */
+struct ocgd_ParsedMesh {
+    std::vector<float> positions;     ///< x, y, z per vertex
+    std::vector<float> normals;       ///< x, y, z per vertex, empty if the file has no usable normals
+    std::vector<int32_t> triangles;   ///< Three 0-based vertex indices per triangle
+
+    int64_t vertex_count() const { return static_cast<int64_t>(positions.size() / 3); }
+    int64_t triangle_count() const { return static_cast<int64_t>(triangles.size() / 3); }
+};
+
+/**
+ * @brief Memory-mapped, multithreaded OBJ, PLY and STL reader.
+ */
+class ocgd_MeshFileParser {
+public:
+    /**
+     * @brief Read a Wavefront OBJ file (v, vn and f records; everything else is ignored).
+     * @param path Path in the local file system (UTF-8)
+     * @param worker_count Number of workers, 0 or less uses one per logical core
+     * @param mesh Receives the mesh
+     * @param error Receives a description of the problem on failure
+     */
+    static bool parse_obj(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error);
+
+    /**
+     * @brief Read a Stanford PLY file; uses the "vertex" (x, y, z, optional nx, ny, nz)
+     * and "face" (vertex_indices or vertex_index list) elements.
+     */
+    static bool parse_ply(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error);
+
+    /**
+     * @brief Read an ASCII or binary STL file. STL stores three corners per triangle, so
+     * corners with identical positions are welded into shared vertices with a hash table
+     * sharded across the workers. STL facet normals are not kept.
+     */
+    static bool parse_stl(const std::string& path, int worker_count, ocgd_ParsedMesh& mesh, std::string& error);
+
+    /**
+     * @brief Copy a parsed mesh into a Poly_Triangulation (with normals if the mesh has them).
+     */
+    static Handle(Poly_Triangulation) to_triangulation(const ocgd_ParsedMesh& mesh, int worker_count);
+
+    /**
+     * @brief Check whether a shape only consists of faces without a surface, such as the
+     * triangulation-only faces built from parsed meshes. Such faces cannot be (re)meshed,
+     * so meshing steps must keep their triangulation instead.
+     */
+    static bool is_mesh_only(const TopoDS_Shape& shape);
+};
+
+#endif // _ocgd_MeshFileParser_HeaderFile
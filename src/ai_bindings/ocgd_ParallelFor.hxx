@@ -0,0 +1,77 @@
+/**
+ * ocgd_ParallelFor.hxx
+ *
+ * Internal helper to run independent per-element work (e.g. per-face extraction) on
+ * OpenCASCADE's thread pool with a configurable number of workers.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_ParallelFor_HeaderFile
+#define _ocgd_ParallelFor_HeaderFile
+
+#include <opencascade/OSD_ThreadPool.hxx>
+
+#include <algorithm>
+
+/**
+ * @brief Parallel loop utility built on OSD_ThreadPool.
+ *
+ * The functor is called as functor(index) for every index in [0, count). Calls for
+ * different indices may run concurrently, so the functor must only write to data
+ * owned by its index (for example a prefix-summed range of a preallocated array).
+ */
+class ocgd_ParallelFor {
+public:
+    /**
+     * @brief Resolve a user-facing worker count setting.
+     * @param worker_count Requested workers; 0 or less means one per logical core
+     * @return Number of workers that will actually be used (at least 1, at most the
+     *         size of OSD_ThreadPool::DefaultPool())
+     */
+    static int resolve_worker_count(int worker_count) {
+        const int pool_threads = std::max(OSD_ThreadPool::DefaultPool()->NbThreads(), 1);
+        if (worker_count == 1) {
+            return 1;
+        }
+        return worker_count > 0 ? std::min(worker_count, pool_threads) : pool_threads;
+    }
+
+    /**
+     * @brief Run functor(index) for all indices in [0, count).
+     * @param count Number of elements
+     * @param worker_count Number of workers; 1 runs serially on the calling thread,
+     *        0 or less uses one worker per logical core. Counts above the size of
+     *        OSD_ThreadPool::DefaultPool() are capped to it
+     * @param functor Callable taking the element index
+     */
+    template <typename Functor>
+    static void run(int count, int worker_count, const Functor& functor) {
+        if (count <= 0) {
+            return;
+        }
+
+        const int workers = resolve_worker_count(worker_count);
+        if (workers == 1 || count == 1) {
+            for (int i = 0; i < count; i++) {
+                functor(i);
+            }
+            return;
+        }
+
+        // OSD_ThreadPool functors receive the worker thread index as well as the element index
+        struct Adaptor {
+            const Functor& functor;
+            void operator()(int /*thread_index*/, int index) const { functor(index); }
+        };
+        Adaptor adaptor{functor};
+
+        // Every loop shares the process-wide pool; an explicit worker count only limits how
+        // many of its threads this loop occupies, so no threads are created per call
+        const Handle(OSD_ThreadPool)& pool = OSD_ThreadPool::DefaultPool();
+        OSD_ThreadPool::Launcher launcher(*pool, workers);
+        launcher.Perform(0, count, adaptor);
+    }
+};
+
+#endif // _ocgd_ParallelFor_HeaderFile
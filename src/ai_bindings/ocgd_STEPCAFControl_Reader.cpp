@@ -7,6 +7,7 @@
  */
 
 #include "ocgd_STEPCAFControl_Reader.hxx"
+#include "ocgd_MemoryStream.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -22,8 +23,6 @@
 #include <opencascade/Message_ProgressRange.hxx>
 #include <opencascade/Standard_Failure.hxx>
 
-#include <sstream>
-
 using namespace godot;
 
 ocgd_STEPCAFControl_Reader::ocgd_STEPCAFControl_Reader() {
@@ -135,14 +134,8 @@ int ocgd_STEPCAFControl_Reader::read_stream(const String& name, const PackedByte
 
         std::string std_name = name.utf8().get_data();
         
-        // Convert PackedByteArray to std::stringstream
-        std::stringstream stream;
-        const uint8_t* raw_data = data.ptr();
-        size_t size = data.size();
-        
-        for (size_t i = 0; i < size; ++i) {
-            stream << static_cast<char>(raw_data[i]);
-        }
+        // Read straight from the PackedByteArray memory, without copying it into a stringstream
+        ocgd_MemoryIStream stream(data.ptr(), static_cast<size_t>(data.size()));
         
         IFSelect_ReturnStatus status = _reader->ReadStream(std_name.c_str(), stream);
         
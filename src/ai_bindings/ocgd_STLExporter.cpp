@@ -7,6 +7,7 @@
  */
 
 #include "ocgd_STLExporter.hxx"
+#include "ocgd_FileAccessSink.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -24,10 +25,198 @@
 #include <opencascade/TopLoc_Location.hxx>
 #include <opencascade/Standard_Failure.hxx>
 
-#include <fstream>
+#include <opencascade/gp_Trsf.hxx>
+#include <opencascade/gp_Pnt.hxx>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 using namespace godot;
 
+namespace {
+
+// Binary STL layout: 80 byte header, uint32 triangle count, then 50 bytes per triangle
+const int64_t STL_BINARY_HEADER_SIZE = 84;
+const int64_t STL_BINARY_TRIANGLE_SIZE = 50;
+
+// Upper bound of one ASCII facet written with "% .6e" coordinates (about 245 characters,
+// with headroom for runtimes that print three exponent digits)
+const int64_t STL_ASCII_FACET_MAX_SIZE = 320;
+
+const char* STL_SOLID_NAME = "shape";
+
+// Triangulated face prepared for serialization
+struct STLFace {
+    Handle(Poly_Triangulation) triangulation;
+    gp_Trsf transformation;
+    bool has_location = false;
+    bool reversed = false;
+};
+
+// Collect all triangulated faces of a shape and count their triangles
+int64_t collect_stl_faces(const TopoDS_Shape& shape, std::vector<STLFace>& faces) {
+    int64_t triangle_count = 0;
+    for (TopExp_Explorer face_explorer(shape, TopAbs_FACE); face_explorer.More(); face_explorer.Next()) {
+        const TopoDS_Face& face = TopoDS::Face(face_explorer.Current());
+        TopLoc_Location location;
+        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
+        if (triangulation.IsNull() || triangulation->NbTriangles() == 0) {
+            continue;
+        }
+
+        STLFace stl_face;
+        stl_face.triangulation = triangulation;
+        stl_face.has_location = !location.IsIdentity();
+        if (stl_face.has_location) {
+            stl_face.transformation = location.Transformation();
+        }
+        stl_face.reversed = face.Orientation() == TopAbs_REVERSED;
+        faces.push_back(stl_face);
+        triangle_count += triangulation->NbTriangles();
+    }
+    return triangle_count;
+}
+
+inline uint8_t* put_uint32_le(uint8_t* dst, uint32_t value) {
+    dst[0] = static_cast<uint8_t>(value);
+    dst[1] = static_cast<uint8_t>(value >> 8);
+    dst[2] = static_cast<uint8_t>(value >> 16);
+    dst[3] = static_cast<uint8_t>(value >> 24);
+    return dst + 4;
+}
+
+// Fetch the three corners of a triangle in output winding, with the face location applied
+inline void get_stl_triangle(const STLFace& face, Standard_Integer index, gp_Pnt& p1, gp_Pnt& p2, gp_Pnt& p3) {
+    Standard_Integer n1, n2, n3;
+    face.triangulation->Triangle(index).Get(n1, n2, n3);
+    if (face.reversed) {
+        std::swap(n2, n3);
+    }
+    p1 = face.triangulation->Node(n1);
+    p2 = face.triangulation->Node(n2);
+    p3 = face.triangulation->Node(n3);
+    if (face.has_location) {
+        p1.Transform(face.transformation);
+        p2.Transform(face.transformation);
+        p3.Transform(face.transformation);
+    }
+}
+
+inline void get_stl_normal(const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3, double& nx, double& ny, double& nz) {
+    const double ax = p2.X() - p1.X(), ay = p2.Y() - p1.Y(), az = p2.Z() - p1.Z();
+    const double bx = p3.X() - p1.X(), by = p3.Y() - p1.Y(), bz = p3.Z() - p1.Z();
+    nx = ay * bz - az * by;
+    ny = az * bx - ax * bz;
+    nz = ax * by - ay * bx;
+    const double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (length > 0.0) {
+        nx /= length;
+        ny /= length;
+        nz /= length;
+    } else {
+        nx = ny = nz = 0.0;
+    }
+}
+
+// Write one binary facet (exactly STL_BINARY_TRIANGLE_SIZE bytes)
+inline uint8_t* write_binary_facet(uint8_t* dst, const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3) {
+    double nx, ny, nz;
+    get_stl_normal(p1, p2, p3, nx, ny, nz);
+    dst = ocgd_put_float_le(dst, static_cast<float>(nx));
+    dst = ocgd_put_float_le(dst, static_cast<float>(ny));
+    dst = ocgd_put_float_le(dst, static_cast<float>(nz));
+    for (const gp_Pnt* p : { &p1, &p2, &p3 }) {
+        dst = ocgd_put_float_le(dst, static_cast<float>(p->X()));
+        dst = ocgd_put_float_le(dst, static_cast<float>(p->Y()));
+        dst = ocgd_put_float_le(dst, static_cast<float>(p->Z()));
+    }
+    dst[0] = 0; // Attribute byte count
+    dst[1] = 0;
+    return dst + 2;
+}
+
+// Write one ASCII facet, returns the number of bytes written (at most STL_ASCII_FACET_MAX_SIZE)
+inline int write_ascii_facet(char* dst, const gp_Pnt& p1, const gp_Pnt& p2, const gp_Pnt& p3) {
+    double nx, ny, nz;
+    get_stl_normal(p1, p2, p3, nx, ny, nz);
+    const int written = std::snprintf(dst, STL_ASCII_FACET_MAX_SIZE,
+        " facet normal % .6e % .6e % .6e\n"
+        "  outer loop\n"
+        "   vertex % .6e % .6e % .6e\n"
+        "   vertex % .6e % .6e % .6e\n"
+        "   vertex % .6e % .6e % .6e\n"
+        "  endloop\n"
+        " endfacet\n",
+        static_cast<float>(nx), static_cast<float>(ny), static_cast<float>(nz),
+        static_cast<float>(p1.X()), static_cast<float>(p1.Y()), static_cast<float>(p1.Z()),
+        static_cast<float>(p2.X()), static_cast<float>(p2.Y()), static_cast<float>(p2.Z()),
+        static_cast<float>(p3.X()), static_cast<float>(p3.Y()), static_cast<float>(p3.Z()));
+    if (written < 0) {
+        return 0;
+    }
+    return written < STL_ASCII_FACET_MAX_SIZE ? written : static_cast<int>(STL_ASCII_FACET_MAX_SIZE - 1);
+}
+
+inline void write_binary_header(uint8_t* dst, int64_t triangle_count) {
+    std::memset(dst, 0, 80);
+    const char* header = "Binary STL exported by OpenCASCADE.gd";
+    std::memcpy(dst, header, std::strlen(header));
+    put_uint32_le(dst + 80, static_cast<uint32_t>(triangle_count));
+}
+
+// Serialize all faces to a sink providing reserve(max_bytes) -> uint8_t* and commit(bytes)
+template <typename Sink>
+void write_stl(const std::vector<STLFace>& faces, int64_t triangle_count, bool ascii_mode, Sink& sink) {
+    gp_Pnt p1, p2, p3;
+    if (ascii_mode) {
+        const int64_t header_size = static_cast<int64_t>(std::strlen("solid \n") + std::strlen(STL_SOLID_NAME));
+        char* header = reinterpret_cast<char*>(sink.reserve(header_size + 1));
+        sink.commit(std::snprintf(header, header_size + 1, "solid %s\n", STL_SOLID_NAME));
+
+        for (const STLFace& face : faces) {
+            const Standard_Integer nb_triangles = face.triangulation->NbTriangles();
+            for (Standard_Integer i = 1; i <= nb_triangles; i++) {
+                get_stl_triangle(face, i, p1, p2, p3);
+                char* dst = reinterpret_cast<char*>(sink.reserve(STL_ASCII_FACET_MAX_SIZE));
+                sink.commit(write_ascii_facet(dst, p1, p2, p3));
+            }
+        }
+
+        const int64_t footer_size = static_cast<int64_t>(std::strlen("endsolid \n") + std::strlen(STL_SOLID_NAME));
+        char* footer = reinterpret_cast<char*>(sink.reserve(footer_size + 1));
+        sink.commit(std::snprintf(footer, footer_size + 1, "endsolid %s\n", STL_SOLID_NAME));
+    } else {
+        write_binary_header(sink.reserve(STL_BINARY_HEADER_SIZE), triangle_count);
+        sink.commit(STL_BINARY_HEADER_SIZE);
+
+        for (const STLFace& face : faces) {
+            const Standard_Integer nb_triangles = face.triangulation->NbTriangles();
+            for (Standard_Integer i = 1; i <= nb_triangles; i++) {
+                get_stl_triangle(face, i, p1, p2, p3);
+                write_binary_facet(sink.reserve(STL_BINARY_TRIANGLE_SIZE), p1, p2, p3);
+                sink.commit(STL_BINARY_TRIANGLE_SIZE);
+            }
+        }
+    }
+}
+
+// Sink writing into a preallocated PackedByteArray
+struct STLByteArraySink {
+    uint8_t* data;
+    int64_t capacity;
+    int64_t size = 0;
+
+    // Capacity is computed up front from the triangle count, so reservations always fit
+    uint8_t* reserve(int64_t /*bytes*/) { return data + size; }
+    void commit(int64_t bytes) { size += bytes; }
+};
+
+} // namespace
+
 ocgd_STLExporter::ocgd_STLExporter() {
     try {
         _writer = new StlAPI_Writer();
@@ -310,40 +499,25 @@ PackedByteArray ocgd_STLExporter::export_to_bytes(const Ref<ocgd_TopoDS_Shape>&
             return result;
         }
 
-        // Create a temporary filename
-        String temp_filename = "temp_export.stl";
-
-        // Set ASCII mode
-        bool original_mode = get_ascii_mode();
-        const_cast<ocgd_STLExporter*>(this)->set_ascii_mode(ascii_mode);
+        std::vector<STLFace> faces;
+        const int64_t triangle_count = collect_stl_faces(shape->get_occt_shape(), faces);
+        if (triangle_count == 0) {
+            UtilityFunctions::printerr("STLExporter: Cannot export to bytes - shape has no triangulation data (run mesh generation first)");
+            return result;
+        }
 
-        // Export to file
-        bool success = const_cast<ocgd_STLExporter*>(this)->write_file(shape, temp_filename);
+        // Binary size is exact; ASCII is bounded per facet and trimmed afterwards
+        const int64_t capacity = ascii_mode
+            ? triangle_count * STL_ASCII_FACET_MAX_SIZE + 2 * STL_ASCII_FACET_MAX_SIZE
+            : STL_BINARY_HEADER_SIZE + triangle_count * STL_BINARY_TRIANGLE_SIZE;
+        result.resize(capacity);
 
-        if (success) {
-            // Read file back into byte array
-            std::ifstream file(temp_filename.utf8().get_data(), std::ios::binary);
-            if (file) {
-                file.seekg(0, std::ios::end);
-                size_t size = file.tellg();
-                file.seekg(0, std::ios::beg);
+        STLByteArraySink sink{ result.ptrw(), capacity };
+        write_stl(faces, triangle_count, ascii_mode, sink);
 
-                if (size > 0) {
-                    result.resize(size);
-                    file.read(reinterpret_cast<char*>(result.ptrw()), size);
-                }
-                file.close();
-
-                // Clean up temp file
-                std::remove(temp_filename.utf8().get_data());
-            } else {
-                UtilityFunctions::printerr("STLExporter: Failed to read back temporary file");
-            }
+        if (sink.size != capacity) {
+            result.resize(sink.size);
         }
-
-        // Restore original mode
-        const_cast<ocgd_STLExporter*>(this)->set_ascii_mode(original_mode);
-
         return result;
 
     } catch (const Standard_Failure& e) {
@@ -355,6 +529,44 @@ PackedByteArray ocgd_STLExporter::export_to_bytes(const Ref<ocgd_TopoDS_Shape>&
     }
 }
 
+bool ocgd_STLExporter::export_to_file_access(const Ref<ocgd_TopoDS_Shape>& shape, const Ref<FileAccess>& file, bool ascii_mode) const {
+    try {
+        if (shape.is_null() || shape->is_null()) {
+            UtilityFunctions::printerr("STLExporter: Cannot export null shape to file");
+            return false;
+        }
+
+        if (file.is_null() || !file->is_open()) {
+            UtilityFunctions::printerr("STLExporter: Cannot export - file is not open");
+            return false;
+        }
+
+        std::vector<STLFace> faces;
+        const int64_t triangle_count = collect_stl_faces(shape->get_occt_shape(), faces);
+        if (triangle_count == 0) {
+            UtilityFunctions::printerr("STLExporter: Cannot export to file - shape has no triangulation data (run mesh generation first)");
+            return false;
+        }
+
+        ocgd_FileAccessSink sink(file);
+        write_stl(faces, triangle_count, ascii_mode, sink);
+        sink.flush();
+
+        if (file->get_error() != OK) {
+            UtilityFunctions::printerr("STLExporter: Write operation failed for file: " + file->get_path());
+            return false;
+        }
+        return true;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("STLExporter: Exception exporting to file - " + String(e.GetMessageString()));
+        return false;
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("STLExporter: Exception exporting to file - " + String(e.what()));
+        return false;
+    }
+}
+
 bool ocgd_STLExporter::quick_export(const Ref<ocgd_TopoDS_Shape>& shape, const String& filename, bool ascii_mode) {
     try {
         set_ascii_mode(ascii_mode);
@@ -489,6 +701,7 @@ void ocgd_STLExporter::_bind_methods() {
     ClassDB::bind_method(D_METHOD("write_file_with_progress", "shape", "filename", "progress_callback"), &ocgd_STLExporter::write_file_with_progress, DEFVAL(""));
     ClassDB::bind_method(D_METHOD("quick_export", "shape", "filename", "ascii_mode"), &ocgd_STLExporter::quick_export, DEFVAL(true));
     ClassDB::bind_method(D_METHOD("export_to_bytes", "shape", "ascii_mode"), &ocgd_STLExporter::export_to_bytes);
+    ClassDB::bind_method(D_METHOD("export_to_file_access", "shape", "file", "ascii_mode"), &ocgd_STLExporter::export_to_file_access);
     ClassDB::bind_method(D_METHOD("export_multiple_shapes", "shapes", "base_filename", "ascii_mode"), &ocgd_STLExporter::export_multiple_shapes, DEFVAL(true));
 
     // Validation and analysis methods
@@ -23,6 +23,7 @@
  */
 
 #include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/string.hpp>
 
@@ -106,11 +107,21 @@ public:
     String validate_shape_for_export(const Ref<ocgd_TopoDS_Shape>& shape) const;
 
     //! Export shape to STL format and return as byte array
-    //! @param shape the shape to export
+    //! Serializes the existing triangulation directly into memory (no temporary file).
+    //! Binary output is allocated once with its exact size.
+    //! @param shape the shape to export (must already be triangulated)
     //! @param ascii_mode whether to use ASCII format
     //! @return STL data as PackedByteArray, empty if failed
     PackedByteArray export_to_bytes(const Ref<ocgd_TopoDS_Shape>& shape, bool ascii_mode) const;
 
+    //! Export shape to STL format into an open Godot file
+    //! Data is streamed in fixed-size chunks, so memory use does not grow with the mesh size.
+    //! @param shape the shape to export (must already be triangulated)
+    //! @param file a FileAccess opened for writing
+    //! @param ascii_mode whether to use ASCII format
+    //! @return true if export succeeded
+    bool export_to_file_access(const Ref<ocgd_TopoDS_Shape>& shape, const Ref<FileAccess>& file, bool ascii_mode) const;
+
     //! Quick export with default settings
     //! @param shape the shape to export
     //! @param filename the output file path
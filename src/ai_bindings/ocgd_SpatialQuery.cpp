@@ -0,0 +1,1115 @@
+/**
+ * ocgd_SpatialQuery.cpp
+ *
+ * Godot GDExtension spatial query structure implementation.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_SpatialQuery.hxx"
+#include "ocgd_MeshFileParser.hxx"
+#include "ocgd_ParallelFor.hxx"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <opencascade/BRepAdaptor_Surface.hxx>
+#include <opencascade/BRepBuilderAPI_Copy.hxx>
+#include <opencascade/Bnd_Box.hxx>
+#include <opencascade/BRepMesh_IncrementalMesh.hxx>
+#include <opencascade/BRepTools.hxx>
+#include <opencascade/BRep_Tool.hxx>
+#include <opencascade/Geom_Surface.hxx>
+#include <opencascade/Precision.hxx>
+#include <opencascade/Standard_Failure.hxx>
+#include <opencascade/TopLoc_Location.hxx>
+#include <opencascade/gp.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+using namespace godot;
+
+namespace {
+
+// Queries handled per parallel work item
+const int64_t QUERY_BLOCK_SIZE = 256;
+
+// Newton iterations used to refine a result onto the exact surface
+const int MAX_REFINE_ITERATIONS = 12;
+
+// Ray-parity classification: rays are cast along these directions in turn until one
+// crosses no triangle near an edge. Skewed directions avoid running along axis-aligned
+// edges and faces, which are common in CAD models.
+const double PARITY_DIRECTIONS[][3] = {
+    {0.5773502691896258, 0.5773502691896258, 0.5773502691896258},
+    {-0.2672612419124244, 0.5345224838248488, 0.8017837257372732},
+    {0.8164965809277261, -0.4082482904638631, 0.4082482904638631},
+};
+const double PARITY_EDGE_TOLERANCE = 1e-7;
+
+// Wall thickness: hits on triangles within this cosine of parallel to the ray are stepped
+// over, at most MAX_GRAZING_HITS times. These are faces meeting the sampled face along its
+// boundary, which the inward ray of a boundary vertex runs along.
+const double THICKNESS_GRAZING_COSINE = 1e-3;
+const int MAX_GRAZING_HITS = 4;
+
+// Percentiles reported by wall thickness analysis
+const int THICKNESS_PERCENTILES[] = {5, 10, 25, 50, 75, 90, 95};
+
+// Interference: crossing triangles are sampled for penetration depth at this fraction of the
+// contact region's diagonal, with at most MAX_PENETRATION_SUBDIVISIONS along an edge
+const double PENETRATION_SAMPLE_RATIO = 1.0 / 32.0;
+const int MAX_PENETRATION_SUBDIVISIONS = 64;
+
+inline gp_Pnt to_gp_pnt(const Vector3& v) {
+    return gp_Pnt(v.x, v.y, v.z);
+}
+
+inline Vector3 to_vector3(const gp_XYZ& xyz) {
+    return Vector3(xyz.X(), xyz.Y(), xyz.Z());
+}
+
+// Surface adaptors of the faces touched by one block of queries. Adaptors cache
+// evaluation data, so each worker uses its own.
+class SurfaceCache {
+public:
+    explicit SurfaceCache(const ocgd_TriangleBVH& bvh) : _bvh(bvh) {}
+
+    BRepAdaptor_Surface& get(int face_index) {
+        std::unique_ptr<BRepAdaptor_Surface>& surface = _surfaces[face_index];
+        if (!surface) {
+            surface.reset(new BRepAdaptor_Surface(_bvh.face(face_index).face));
+        }
+        return *surface;
+    }
+
+private:
+    const ocgd_TriangleBVH& _bvh;
+    std::unordered_map<int, std::unique_ptr<BRepAdaptor_Surface>> _surfaces;
+};
+
+// Unit surface normal at (u, v), oriented like the face; false where the surface is degenerate
+bool surface_normal(const BRepAdaptor_Surface& surface, double u, double v, bool reversed, gp_Vec& normal) {
+    gp_Pnt point;
+    gp_Vec d1u, d1v;
+    surface.D1(u, v, point, d1u, d1v);
+    normal = d1u.Crossed(d1v);
+    const double magnitude = normal.Magnitude();
+    if (magnitude <= gp::Resolution()) {
+        return false;
+    }
+    normal /= reversed ? -magnitude : magnitude;
+    return true;
+}
+
+// Newton iteration for the surface point closest to a point, starting from (u, v) and
+// kept inside the face's parameter bounds
+gp_Pnt2d project_on_surface(const BRepAdaptor_Surface& surface, const gp_Pnt& point, gp_Pnt2d uv,
+                            double u_min, double u_max, double v_min, double v_max) {
+    double u = uv.X();
+    double v = uv.Y();
+    for (int iteration = 0; iteration < MAX_REFINE_ITERATIONS; iteration++) {
+        gp_Pnt surface_point;
+        gp_Vec d1u, d1v, d2u, d2v, d2uv;
+        surface.D2(u, v, surface_point, d1u, d1v, d2u, d2v, d2uv);
+
+        // Minimize the squared distance: gradient and Hessian in (u, v)
+        const gp_Vec offset(point, surface_point);
+        const double gu = d1u.Dot(offset);
+        const double gv = d1v.Dot(offset);
+        const double huu = d1u.Dot(d1u) + d2u.Dot(offset);
+        const double huv = d1u.Dot(d1v) + d2uv.Dot(offset);
+        const double hvv = d1v.Dot(d1v) + d2v.Dot(offset);
+        const double determinant = huu * hvv - huv * huv;
+        if (std::abs(determinant) <= gp::Resolution()) {
+            break;
+        }
+
+        const double du = -(hvv * gu - huv * gv) / determinant;
+        const double dv = -(huu * gv - huv * gu) / determinant;
+        u = std::min(std::max(u + du, u_min), u_max);
+        v = std::min(std::max(v + dv, v_min), v_max);
+        if (std::abs(du) <= Precision::PConfusion() && std::abs(dv) <= Precision::PConfusion()) {
+            break;
+        }
+    }
+    return gp_Pnt2d(u, v);
+}
+
+// Newton iteration for the intersection of a ray with a surface, starting from (u, v, t);
+// false if it does not converge inside the face's parameter bounds
+bool intersect_surface(const BRepAdaptor_Surface& surface, const gp_Pnt& origin, const gp_Vec& direction,
+                       double u_min, double u_max, double v_min, double v_max, gp_Pnt2d& uv, double& t) {
+    double u = uv.X();
+    double v = uv.Y();
+    for (int iteration = 0; iteration < MAX_REFINE_ITERATIONS; iteration++) {
+        gp_Pnt surface_point;
+        gp_Vec d1u, d1v;
+        surface.D1(u, v, surface_point, d1u, d1v);
+
+        // Solve [d1u d1v -direction] * (du, dv, dt) = -residual by Cramer's rule
+        const gp_Pnt ray_point = origin.Translated(direction * t);
+        const gp_Vec residual(ray_point, surface_point);
+        if (residual.Magnitude() <= Precision::Confusion()) {
+            uv.SetCoord(u, v);
+            return true;
+        }
+
+        const gp_Vec minus_direction = direction.Reversed();
+        const double determinant = d1u.Dot(d1v.Crossed(minus_direction));
+        if (std::abs(determinant) <= gp::Resolution()) {
+            return false;
+        }
+        const gp_Vec rhs = residual.Reversed();
+        const double du = rhs.Dot(d1v.Crossed(minus_direction)) / determinant;
+        const double dv = d1u.Dot(rhs.Crossed(minus_direction)) / determinant;
+        const double dt = d1u.Dot(d1v.Crossed(rhs)) / determinant;
+        u = std::min(std::max(u + du, u_min), u_max);
+        v = std::min(std::max(v + dv, v_min), v_max);
+        t += dt;
+    }
+    return false;
+}
+
+// Bounding box of the triangles of one face
+struct FaceBox {
+    double min[3];
+    double max[3];
+    int face;
+};
+
+// Bounding boxes of the faces that have triangles, grown by a margin
+std::vector<FaceBox> face_boxes(const ocgd_TriangleBVH& bvh, double margin) {
+    std::vector<FaceBox> boxes(bvh.face_count());
+    for (int f = 0; f < bvh.face_count(); f++) {
+        boxes[f].face = f;
+        for (int k = 0; k < 3; k++) {
+            boxes[f].min[k] = std::numeric_limits<double>::infinity();
+            boxes[f].max[k] = -std::numeric_limits<double>::infinity();
+        }
+    }
+    for (int t = 0; t < bvh.triangle_count(); t++) {
+        FaceBox& box = boxes[bvh.triangle_face(t)];
+        for (int corner = 0; corner < 3; corner++) {
+            const gp_Pnt node = bvh.triangle_node(t, corner);
+            for (int k = 0; k < 3; k++) {
+                box.min[k] = std::min(box.min[k], node.Coord(k + 1));
+                box.max[k] = std::max(box.max[k], node.Coord(k + 1));
+            }
+        }
+    }
+
+    boxes.erase(std::remove_if(boxes.begin(), boxes.end(), [](const FaceBox& box) { return box.min[0] > box.max[0]; }),
+                boxes.end());
+    for (FaceBox& box : boxes) {
+        for (int k = 0; k < 3; k++) {
+            box.min[k] -= margin;
+            box.max[k] += margin;
+        }
+    }
+    return boxes;
+}
+
+// Pairs of overlapping boxes, as (first face, second face), by sweeping both lists along x
+std::vector<std::pair<int, int>> sweep_and_prune(std::vector<FaceBox>& first, std::vector<FaceBox>& second) {
+    const auto by_min_x = [](const FaceBox& a, const FaceBox& b) { return a.min[0] < b.min[0]; };
+    std::sort(first.begin(), first.end(), by_min_x);
+    std::sort(second.begin(), second.end(), by_min_x);
+
+    const auto overlaps_yz = [](const FaceBox& a, const FaceBox& b) {
+        return a.min[1] <= b.max[1] && b.min[1] <= a.max[1] && a.min[2] <= b.max[2] && b.min[2] <= a.max[2];
+    };
+
+    // Each pair is found once, from the box that starts first along x
+    std::vector<std::pair<int, int>> pairs;
+    size_t i = 0;
+    size_t j = 0;
+    while (i < first.size() && j < second.size()) {
+        if (first[i].min[0] <= second[j].min[0]) {
+            for (size_t k = j; k < second.size() && second[k].min[0] <= first[i].max[0]; k++) {
+                if (overlaps_yz(first[i], second[k])) {
+                    pairs.emplace_back(first[i].face, second[k].face);
+                }
+            }
+            i++;
+        } else {
+            for (size_t k = i; k < first.size() && first[k].min[0] <= second[j].max[0]; k++) {
+                if (overlaps_yz(first[k], second[j])) {
+                    pairs.emplace_back(first[k].face, second[j].face);
+                }
+            }
+            j++;
+        }
+    }
+    return pairs;
+}
+
+} // namespace
+
+void ocgd_SpatialQuery::_bind_methods() {
+    BIND_ENUM_CONSTANT(POINT_STATE_IN);
+    BIND_ENUM_CONSTANT(POINT_STATE_OUT);
+    BIND_ENUM_CONSTANT(POINT_STATE_ON);
+    BIND_ENUM_CONSTANT(POINT_STATE_UNKNOWN);
+
+    // Settings
+    ClassDB::bind_method(D_METHOD("set_linear_deflection", "deflection"), &ocgd_SpatialQuery::set_linear_deflection);
+    ClassDB::bind_method(D_METHOD("get_linear_deflection"), &ocgd_SpatialQuery::get_linear_deflection);
+    ClassDB::bind_method(D_METHOD("set_angular_deflection", "deflection"), &ocgd_SpatialQuery::set_angular_deflection);
+    ClassDB::bind_method(D_METHOD("get_angular_deflection"), &ocgd_SpatialQuery::get_angular_deflection);
+    ClassDB::bind_method(D_METHOD("set_refine_to_surface", "refine"), &ocgd_SpatialQuery::set_refine_to_surface);
+    ClassDB::bind_method(D_METHOD("get_refine_to_surface"), &ocgd_SpatialQuery::get_refine_to_surface);
+    ClassDB::bind_method(D_METHOD("set_worker_count", "count"), &ocgd_SpatialQuery::set_worker_count);
+    ClassDB::bind_method(D_METHOD("get_worker_count"), &ocgd_SpatialQuery::get_worker_count);
+
+    // Building
+    ClassDB::bind_method(D_METHOD("build", "shape"), &ocgd_SpatialQuery::build);
+    ClassDB::bind_method(D_METHOD("build_from_shape", "shape"), &ocgd_SpatialQuery::build_from_shape);
+    ClassDB::bind_method(D_METHOD("clear"), &ocgd_SpatialQuery::clear);
+    ClassDB::bind_method(D_METHOD("is_built"), &ocgd_SpatialQuery::is_built);
+    ClassDB::bind_method(D_METHOD("get_triangle_count"), &ocgd_SpatialQuery::get_triangle_count);
+    ClassDB::bind_method(D_METHOD("get_face_count"), &ocgd_SpatialQuery::get_face_count);
+
+    // Queries
+    ClassDB::bind_method(D_METHOD("closest_points", "points", "max_distance"), &ocgd_SpatialQuery::closest_points, DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("distances", "points", "max_distance"), &ocgd_SpatialQuery::distances, DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("intersect_rays", "origins", "directions", "max_distance"), &ocgd_SpatialQuery::intersect_rays, DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("classify_points", "points", "tolerance", "ray_parity"), &ocgd_SpatialQuery::classify_points, DEFVAL(1e-7), DEFVAL(false));
+    ClassDB::bind_method(D_METHOD("wall_thickness", "max_thickness"), &ocgd_SpatialQuery::wall_thickness, DEFVAL(0.0));
+    ClassDB::bind_method(D_METHOD("interference", "other"), &ocgd_SpatialQuery::interference);
+
+    ClassDB::add_property("ocgd_SpatialQuery", PropertyInfo(Variant::FLOAT, "linear_deflection"), "set_linear_deflection", "get_linear_deflection");
+    ClassDB::add_property("ocgd_SpatialQuery", PropertyInfo(Variant::FLOAT, "angular_deflection"), "set_angular_deflection", "get_angular_deflection");
+    ClassDB::add_property("ocgd_SpatialQuery", PropertyInfo(Variant::BOOL, "refine_to_surface"), "set_refine_to_surface", "get_refine_to_surface");
+    ClassDB::add_property("ocgd_SpatialQuery", PropertyInfo(Variant::INT, "worker_count"), "set_worker_count", "get_worker_count");
+}
+
+ocgd_SpatialQuery::ocgd_SpatialQuery() :
+    _linear_deflection(0.1),
+    _angular_deflection(0.5),
+    _refine_to_surface(false),
+    _worker_count(0),
+    _has_surfaces(false) {
+}
+
+ocgd_SpatialQuery::~ocgd_SpatialQuery() {
+}
+
+void ocgd_SpatialQuery::set_linear_deflection(double deflection) {
+    _linear_deflection = deflection;
+}
+
+double ocgd_SpatialQuery::get_linear_deflection() const {
+    return _linear_deflection;
+}
+
+void ocgd_SpatialQuery::set_angular_deflection(double deflection) {
+    _angular_deflection = deflection;
+}
+
+double ocgd_SpatialQuery::get_angular_deflection() const {
+    return _angular_deflection;
+}
+
+void ocgd_SpatialQuery::set_refine_to_surface(bool refine) {
+    _refine_to_surface = refine;
+}
+
+bool ocgd_SpatialQuery::get_refine_to_surface() const {
+    return _refine_to_surface;
+}
+
+void ocgd_SpatialQuery::set_worker_count(int count) {
+    _worker_count = count;
+}
+
+int ocgd_SpatialQuery::get_worker_count() const {
+    return _worker_count;
+}
+
+bool ocgd_SpatialQuery::build_occt_shape(const TopoDS_Shape& shape) {
+    clear();
+
+    try {
+        if (shape.IsNull()) {
+            UtilityFunctions::printerr("SpatialQuery: Cannot build - OpenCASCADE shape is null");
+            return false;
+        }
+
+        // The shape is meshed as a copy sharing its geometry and triangulations, so the
+        // caller's triangulation is left as it was. Faces whose existing triangulation already
+        // meets the deflection are kept as is; imported meshes have no surfaces to mesh
+        const bool mesh_only = ocgd_MeshFileParser::is_mesh_only(shape);
+        TopoDS_Shape meshed = shape;
+        if (!mesh_only) {
+            BRepBuilderAPI_Copy copier(shape, Standard_False, Standard_True);
+            meshed = copier.Shape();
+            BRepMesh_IncrementalMesh mesher(meshed, _linear_deflection, Standard_False, _angular_deflection, Standard_True);
+            if (!mesher.IsDone()) {
+                UtilityFunctions::printerr("SpatialQuery: Failed to triangulate shape");
+                return false;
+            }
+        }
+
+        _bvh.build(meshed, _worker_count);
+        if (_bvh.is_empty()) {
+            UtilityFunctions::printerr("SpatialQuery: Shape has no triangles");
+            return false;
+        }
+        _shape = meshed;
+        _has_surfaces = !mesh_only;
+
+        _face_bounds.resize(_bvh.face_count());
+        for (int i = 0; i < _bvh.face_count(); i++) {
+            const ocgd_TriangleBVH::FaceEntry& entry = _bvh.face(i);
+            FaceBounds& bounds = _face_bounds[i];
+            if (entry.triangulation.IsNull() || !entry.triangulation->HasUVNodes()) {
+                continue;
+            }
+            TopLoc_Location location;
+            if (BRep_Tool::Surface(entry.face, location).IsNull()) {
+                continue;
+            }
+            BRepTools::UVBounds(entry.face, bounds.u_min, bounds.u_max, bounds.v_min, bounds.v_max);
+            bounds.refinable = true;
+        }
+        return true;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception building query structure - " + String(e.GetMessageString()));
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception building query structure - " + String(e.what()));
+    }
+
+    clear();
+    return false;
+}
+
+bool ocgd_SpatialQuery::build(const Ref<ocgd_TopoDS_Shape>& shape) {
+    if (shape.is_null() || shape->is_null()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot build - shape is null");
+        clear();
+        return false;
+    }
+    return build_occt_shape(shape->get_occt_shape());
+}
+
+bool ocgd_SpatialQuery::build_from_shape(const Ref<ocgd_shape>& shape) {
+    if (shape.is_null() || !shape->has_shape()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot build - shape is null");
+        clear();
+        return false;
+    }
+    return build_occt_shape(*shape->_get_shape_ptr());
+}
+
+void ocgd_SpatialQuery::clear() {
+    _bvh.clear();
+    _face_bounds.clear();
+    _shape.Nullify();
+    _has_surfaces = false;
+
+    std::lock_guard<std::mutex> lock(_classifier_mutex);
+    _classifiers.clear();
+}
+
+bool ocgd_SpatialQuery::is_built() const {
+    return !_bvh.is_empty();
+}
+
+int ocgd_SpatialQuery::get_triangle_count() const {
+    return _bvh.triangle_count();
+}
+
+int ocgd_SpatialQuery::get_face_count() const {
+    return _bvh.face_count();
+}
+
+const ocgd_TriangleBVH& ocgd_SpatialQuery::get_bvh() const {
+    return _bvh;
+}
+
+template <typename Functor>
+void ocgd_SpatialQuery::run_batch(int64_t count, const Functor& functor) const {
+    const int block_count = static_cast<int>((count + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE);
+    ocgd_ParallelFor::run(block_count, _worker_count, [&](int block) {
+        SurfaceCache surfaces(_bvh);
+        const int64_t first = block * QUERY_BLOCK_SIZE;
+        const int64_t last = std::min(first + QUERY_BLOCK_SIZE, count);
+        for (int64_t i = first; i < last; i++) {
+            functor(i, surfaces);
+        }
+    });
+}
+
+Dictionary ocgd_SpatialQuery::closest_points(const PackedVector3Array& points, double max_distance) const {
+    Dictionary result;
+    if (!is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot query - nothing has been built");
+        return result;
+    }
+
+    try {
+        const int64_t count = points.size();
+        PackedVector3Array closest;
+        PackedVector3Array normals;
+        PackedFloat64Array distances;
+        PackedInt32Array face_indices;
+        closest.resize(count);
+        normals.resize(count);
+        distances.resize(count);
+        face_indices.resize(count);
+
+        const Vector3* point_data = points.ptr();
+        Vector3* closest_data = closest.ptrw();
+        Vector3* normal_data = normals.ptrw();
+        double* distance_data = distances.ptrw();
+        int32_t* face_data = face_indices.ptrw();
+
+        run_batch(count, [&](int64_t i, SurfaceCache& surfaces) {
+            const gp_Pnt point = to_gp_pnt(point_data[i]);
+            ocgd_TriangleBVH::TrianglePoint hit;
+            if (!_bvh.closest_point(point, max_distance, hit)) {
+                closest_data[i] = Vector3();
+                normal_data[i] = Vector3();
+                distance_data[i] = -1.0;
+                face_data[i] = -1;
+                return;
+            }
+
+            const int face_index = _bvh.triangle_face(hit.triangle);
+            gp_Vec normal = _bvh.triangle_normal(hit.triangle);
+            gp_Pnt2d uv;
+            if (_refine_to_surface && _face_bounds[face_index].refinable && _bvh.triangle_uv(hit.triangle, hit.u, hit.v, uv)) {
+                const FaceBounds& bounds = _face_bounds[face_index];
+                const BRepAdaptor_Surface& surface = surfaces.get(face_index);
+                uv = project_on_surface(surface, point, uv, bounds.u_min, bounds.u_max, bounds.v_min, bounds.v_max);
+                const gp_Pnt refined = surface.Value(uv.X(), uv.Y());
+
+                // Newton may run off to another branch of the surface; stay near the triangle
+                if (refined.Distance(hit.point) <= _bvh.triangle_size(hit.triangle)) {
+                    hit.point = refined;
+                    hit.distance = refined.Distance(point);
+                    gp_Vec surface_normal_vector;
+                    if (surface_normal(surface, uv.X(), uv.Y(), _bvh.face(face_index).reversed, surface_normal_vector)) {
+                        normal = surface_normal_vector;
+                    }
+                }
+            }
+            if (normal.SquareMagnitude() > 0.0) {
+                normal.Normalize();
+            }
+
+            closest_data[i] = to_vector3(hit.point.XYZ());
+            normal_data[i] = to_vector3(normal.XYZ());
+            distance_data[i] = hit.distance;
+            face_data[i] = face_index;
+        });
+
+        result["points"] = closest;
+        result["normals"] = normals;
+        result["distances"] = distances;
+        result["face_indices"] = face_indices;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in closest point query - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in closest point query - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
+
+PackedFloat64Array ocgd_SpatialQuery::distances(const PackedVector3Array& points, double max_distance) const {
+    PackedFloat64Array result;
+    if (!is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot query - nothing has been built");
+        return result;
+    }
+
+    if (_refine_to_surface) {
+        // Refinement needs the full closest point query
+        const Dictionary closest = closest_points(points, max_distance);
+        if (closest.has("distances")) {
+            result = closest["distances"];
+        }
+        return result;
+    }
+
+    try {
+        const int64_t count = points.size();
+        result.resize(count);
+        const Vector3* point_data = points.ptr();
+        double* distance_data = result.ptrw();
+
+        run_batch(count, [&](int64_t i, SurfaceCache&) {
+            ocgd_TriangleBVH::TrianglePoint hit;
+            distance_data[i] = _bvh.closest_point(to_gp_pnt(point_data[i]), max_distance, hit) ? hit.distance : -1.0;
+        });
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in distance query - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in distance query - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
+
+template <typename Cache>
+gp_Vec ocgd_SpatialQuery::refine_ray_hit(const gp_Pnt& origin, const gp_Vec& direction, double max_distance,
+                                         ocgd_TriangleBVH::TrianglePoint& hit, Cache& surfaces) const {
+    const int face_index = _bvh.triangle_face(hit.triangle);
+    gp_Vec normal = _bvh.triangle_normal(hit.triangle);
+    gp_Pnt2d uv;
+    if (_refine_to_surface && _face_bounds[face_index].refinable && _bvh.triangle_uv(hit.triangle, hit.u, hit.v, uv)) {
+        const FaceBounds& bounds = _face_bounds[face_index];
+        const BRepAdaptor_Surface& surface = surfaces.get(face_index);
+        double t = hit.distance;
+        if (intersect_surface(surface, origin, direction, bounds.u_min, bounds.u_max, bounds.v_min, bounds.v_max, uv, t)
+            && t >= 0.0 && (max_distance <= 0.0 || t <= max_distance)
+            && std::abs(t - hit.distance) <= _bvh.triangle_size(hit.triangle)) {
+            hit.point = origin.Translated(direction * t);
+            hit.distance = t;
+            gp_Vec surface_normal_vector;
+            if (surface_normal(surface, uv.X(), uv.Y(), _bvh.face(face_index).reversed, surface_normal_vector)) {
+                normal = surface_normal_vector;
+            }
+        }
+    }
+    if (normal.SquareMagnitude() > 0.0) {
+        normal.Normalize();
+    }
+    return normal;
+}
+
+Dictionary ocgd_SpatialQuery::intersect_rays(const PackedVector3Array& origins, const PackedVector3Array& directions,
+                                             double max_distance) const {
+    Dictionary result;
+    if (!is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot query - nothing has been built");
+        return result;
+    }
+    if (origins.size() != directions.size()) {
+        UtilityFunctions::printerr("SpatialQuery: Ray origins and directions differ in size");
+        return result;
+    }
+
+    try {
+        const int64_t count = origins.size();
+        PackedVector3Array hit_points;
+        PackedVector3Array normals;
+        PackedFloat64Array distances;
+        PackedInt32Array face_indices;
+        hit_points.resize(count);
+        normals.resize(count);
+        distances.resize(count);
+        face_indices.resize(count);
+
+        const Vector3* origin_data = origins.ptr();
+        const Vector3* direction_data = directions.ptr();
+        Vector3* hit_data = hit_points.ptrw();
+        Vector3* normal_data = normals.ptrw();
+        double* distance_data = distances.ptrw();
+        int32_t* face_data = face_indices.ptrw();
+
+        run_batch(count, [&](int64_t i, SurfaceCache& surfaces) {
+            hit_data[i] = Vector3();
+            normal_data[i] = Vector3();
+            distance_data[i] = -1.0;
+            face_data[i] = -1;
+
+            gp_Vec direction(direction_data[i].x, direction_data[i].y, direction_data[i].z);
+            if (direction.Magnitude() <= gp::Resolution()) {
+                return;
+            }
+            direction.Normalize();
+
+            const gp_Pnt origin = to_gp_pnt(origin_data[i]);
+            ocgd_TriangleBVH::TrianglePoint hit;
+            if (!_bvh.intersect_ray(origin, direction, 0.0, max_distance, hit)) {
+                return;
+            }
+
+            const gp_Vec normal = refine_ray_hit(origin, direction, max_distance, hit, surfaces);
+
+            hit_data[i] = to_vector3(hit.point.XYZ());
+            normal_data[i] = to_vector3(normal.XYZ());
+            distance_data[i] = hit.distance;
+            face_data[i] = _bvh.triangle_face(hit.triangle);
+        });
+
+        result["points"] = hit_points;
+        result["normals"] = normals;
+        result["distances"] = distances;
+        result["face_indices"] = face_indices;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in ray query - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception in ray query - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
+
+std::unique_ptr<BRepClass3d_SolidClassifier> ocgd_SpatialQuery::acquire_classifier() const {
+    {
+        std::lock_guard<std::mutex> lock(_classifier_mutex);
+        if (!_classifiers.empty()) {
+            std::unique_ptr<BRepClass3d_SolidClassifier> classifier = std::move(_classifiers.back());
+            _classifiers.pop_back();
+            return classifier;
+        }
+    }
+
+    // Loading builds the classifier's face bounding structures, the costly part of a query
+    std::unique_ptr<BRepClass3d_SolidClassifier> classifier(new BRepClass3d_SolidClassifier());
+    classifier->Load(_shape);
+    return classifier;
+}
+
+void ocgd_SpatialQuery::release_classifier(std::unique_ptr<BRepClass3d_SolidClassifier> classifier) const {
+    std::lock_guard<std::mutex> lock(_classifier_mutex);
+    _classifiers.push_back(std::move(classifier));
+}
+
+ocgd_SpatialQuery::PointState ocgd_SpatialQuery::classify_by_parity(const gp_Pnt& point, double tolerance) const {
+    ocgd_TriangleBVH::TrianglePoint nearest;
+    if (_bvh.closest_point(point, tolerance, nearest)) {
+        return POINT_STATE_ON;
+    }
+
+    for (const double* direction : PARITY_DIRECTIONS) {
+        bool ambiguous = false;
+        const int crossings = _bvh.ray_crossings(point, gp_Vec(direction[0], direction[1], direction[2]),
+                                                 PARITY_EDGE_TOLERANCE, ambiguous);
+        if (!ambiguous) {
+            return (crossings % 2 == 1) ? POINT_STATE_IN : POINT_STATE_OUT;
+        }
+    }
+    return POINT_STATE_UNKNOWN;
+}
+
+PackedByteArray ocgd_SpatialQuery::classify_points(const PackedVector3Array& points, double tolerance, bool ray_parity) const {
+    PackedByteArray result;
+    if (!is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot classify - nothing has been built");
+        return result;
+    }
+
+    try {
+        const double classify_tolerance = tolerance > 0.0 ? tolerance : Precision::Confusion();
+        // Meshes without surfaces can only be classified on their triangles
+        const bool use_parity = ray_parity || !_has_surfaces;
+
+        const int64_t count = points.size();
+        result.resize(count);
+        const Vector3* point_data = points.ptr();
+        uint8_t* state_data = result.ptrw();
+
+        const int block_count = static_cast<int>((count + QUERY_BLOCK_SIZE - 1) / QUERY_BLOCK_SIZE);
+        ocgd_ParallelFor::run(block_count, _worker_count, [&](int block) {
+            // Borrowed on first exact query of the block, so pure parity runs never load one
+            std::unique_ptr<BRepClass3d_SolidClassifier> classifier;
+            const int64_t first = block * QUERY_BLOCK_SIZE;
+            const int64_t last = std::min(first + QUERY_BLOCK_SIZE, count);
+            for (int64_t i = first; i < last; i++) {
+                const gp_Pnt point = to_gp_pnt(point_data[i]);
+                if (use_parity) {
+                    const PointState state = classify_by_parity(point, classify_tolerance);
+                    if (state != POINT_STATE_UNKNOWN || !_has_surfaces) {
+                        state_data[i] = static_cast<uint8_t>(state);
+                        continue;
+                    }
+                }
+
+                if (!classifier) {
+                    classifier = acquire_classifier();
+                }
+                classifier->Perform(point, classify_tolerance);
+                state_data[i] = static_cast<uint8_t>(classifier->State());
+            }
+            if (classifier) {
+                release_classifier(std::move(classifier));
+            }
+        });
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception classifying points - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception classifying points - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
+
+Dictionary ocgd_SpatialQuery::wall_thickness(double max_thickness) const {
+    Dictionary result;
+    if (!is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot measure thickness - nothing has been built");
+        return result;
+    }
+
+    try {
+        const int node_count = _bvh.node_count();
+        const int triangle_count = _bvh.triangle_count();
+
+        // Area-weighted vertex normals; faces do not share nodes, so normals stay sharp at edges
+        std::vector<gp_Vec> node_normals(node_count, gp_Vec(0.0, 0.0, 0.0));
+        std::vector<int32_t> node_faces(node_count, -1);
+        PackedInt32Array triangles;
+        triangles.resize(static_cast<int64_t>(triangle_count) * 3);
+        int32_t* triangle_data = triangles.ptrw();
+        for (int t = 0; t < triangle_count; t++) {
+            const int face_index = _bvh.triangle_face(t);
+            const gp_Vec normal = _bvh.triangle_normal(t);
+            int corners[3];
+            for (int k = 0; k < 3; k++) {
+                corners[k] = _bvh.triangle_node_index(t, k);
+                node_normals[corners[k]] += normal;
+                node_faces[corners[k]] = face_index;
+            }
+
+            // Outward counter-clockwise on forward faces; Godot front faces are clockwise
+            const bool reversed = _bvh.face(face_index).reversed;
+            triangle_data[t * 3] = corners[0];
+            triangle_data[t * 3 + 1] = reversed ? corners[1] : corners[2];
+            triangle_data[t * 3 + 2] = reversed ? corners[2] : corners[1];
+        }
+
+        PackedVector3Array vertices;
+        PackedVector3Array normals;
+        PackedFloat64Array thicknesses;
+        PackedInt32Array face_indices;
+        vertices.resize(node_count);
+        normals.resize(node_count);
+        thicknesses.resize(node_count);
+        face_indices.resize(node_count);
+
+        Vector3* vertex_data = vertices.ptrw();
+        Vector3* normal_data = normals.ptrw();
+        double* thickness_data = thicknesses.ptrw();
+        int32_t* face_data = face_indices.ptrw();
+
+        run_batch(node_count, [&](int64_t i, SurfaceCache& surfaces) {
+            const int node = static_cast<int>(i);
+            const gp_Pnt origin = _bvh.node_point(node);
+            const int face_index = node_faces[node];
+            vertex_data[i] = to_vector3(origin.XYZ());
+            normal_data[i] = Vector3();
+            thickness_data[i] = -1.0;
+            face_data[i] = face_index;
+            if (face_index < 0) {
+                return;
+            }
+
+            gp_Vec normal = node_normals[node];
+            const ocgd_TriangleBVH::FaceEntry& entry = _bvh.face(face_index);
+            if (_refine_to_surface && _face_bounds[face_index].refinable) {
+                const gp_Pnt2d uv = entry.triangulation->UVNode(node - entry.first_node + 1);
+                gp_Vec surface_normal_vector;
+                if (surface_normal(surfaces.get(face_index), uv.X(), uv.Y(), entry.reversed, surface_normal_vector)) {
+                    normal = surface_normal_vector;
+                }
+            }
+            if (normal.Magnitude() <= gp::Resolution()) {
+                return;
+            }
+            normal.Normalize();
+            normal_data[i] = to_vector3(normal.XYZ());
+
+            const gp_Vec direction = normal.Reversed();
+            double min_distance = Precision::Confusion();
+            for (int attempt = 0; attempt < MAX_GRAZING_HITS; attempt++) {
+                ocgd_TriangleBVH::TrianglePoint hit;
+                if (!_bvh.intersect_ray(origin, direction, min_distance, max_thickness, hit)) {
+                    return;
+                }
+                const gp_Vec hit_normal = _bvh.triangle_normal(hit.triangle);
+                if (std::abs(hit_normal.Dot(direction)) > THICKNESS_GRAZING_COSINE * hit_normal.Magnitude()) {
+                    refine_ray_hit(origin, direction, max_thickness, hit, surfaces);
+                    thickness_data[i] = hit.distance;
+                    return;
+                }
+                min_distance = hit.distance + Precision::Confusion();
+            }
+        });
+
+        // Summary statistics over the vertices where a wall was found
+        std::vector<double> measured;
+        measured.reserve(node_count);
+        int thinnest = -1;
+        for (int i = 0; i < node_count; i++) {
+            if (thickness_data[i] < 0.0) {
+                continue;
+            }
+            measured.push_back(thickness_data[i]);
+            if (thinnest < 0 || thickness_data[i] < thickness_data[thinnest]) {
+                thinnest = i;
+            }
+        }
+
+        Dictionary percentiles;
+        double mean = -1.0;
+        if (!measured.empty()) {
+            std::sort(measured.begin(), measured.end());
+            double sum = 0.0;
+            for (double value : measured) {
+                sum += value;
+            }
+            mean = sum / static_cast<double>(measured.size());
+
+            // Linear interpolation between closest ranks
+            for (int percentile : THICKNESS_PERCENTILES) {
+                const double rank = percentile / 100.0 * static_cast<double>(measured.size() - 1);
+                const size_t lower = static_cast<size_t>(rank);
+                const size_t upper = std::min(lower + 1, measured.size() - 1);
+                percentiles[percentile] = measured[lower] + (rank - lower) * (measured[upper] - measured[lower]);
+            }
+        }
+
+        result["vertices"] = vertices;
+        result["normals"] = normals;
+        result["triangles"] = triangles;
+        result["thickness"] = thicknesses;
+        result["face_indices"] = face_indices;
+        result["measured_count"] = static_cast<int64_t>(measured.size());
+        result["min_thickness"] = measured.empty() ? -1.0 : measured.front();
+        result["max_thickness"] = measured.empty() ? -1.0 : measured.back();
+        result["mean_thickness"] = mean;
+        result["percentiles"] = percentiles;
+        result["min_point"] = thinnest < 0 ? Vector3() : vertex_data[thinnest];
+        result["min_face_index"] = thinnest < 0 ? -1 : face_data[thinnest];
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception measuring wall thickness - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception measuring wall thickness - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
+
+double ocgd_SpatialQuery::penetration_depth(const std::vector<int>& crossing_triangles, double sample_spacing,
+                                            const ocgd_SpatialQuery& other) const {
+    // Only vertices inside the other shape's box can be inside the other shape
+    gp_Pnt other_min, other_max;
+    other._bvh.bounds(other_min, other_max);
+    PackedVector3Array samples;
+    for (int node = 0; node < _bvh.node_count(); node++) {
+        const gp_Pnt point = _bvh.node_point(node);
+        if (point.X() >= other_min.X() && point.X() <= other_max.X() && point.Y() >= other_min.Y()
+            && point.Y() <= other_max.Y() && point.Z() >= other_min.Z() && point.Z() <= other_max.Z()) {
+            samples.push_back(to_vector3(point.XYZ()));
+        }
+    }
+
+    // Crossing triangles can be much larger than the region they cross, e.g. on planar faces
+    for (int triangle : crossing_triangles) {
+        const gp_XYZ a = _bvh.triangle_node(triangle, 0).XYZ();
+        const gp_XYZ b = _bvh.triangle_node(triangle, 1).XYZ();
+        const gp_XYZ c = _bvh.triangle_node(triangle, 2).XYZ();
+        const int subdivisions = sample_spacing > 0.0
+            ? std::min(MAX_PENETRATION_SUBDIVISIONS, static_cast<int>(std::ceil(_bvh.triangle_size(triangle) / sample_spacing)))
+            : 1;
+        for (int i = 0; i <= subdivisions; i++) {
+            for (int j = 0; i + j <= subdivisions; j++) {
+                const double u = static_cast<double>(i) / subdivisions;
+                const double v = static_cast<double>(j) / subdivisions;
+                samples.push_back(to_vector3(a + (b - a) * u + (c - a) * v));
+            }
+        }
+    }
+    if (samples.is_empty()) {
+        return 0.0;
+    }
+
+    const PackedByteArray states = other.classify_points(samples, Precision::Confusion(), true);
+    PackedVector3Array inside;
+    for (int64_t i = 0; i < states.size(); i++) {
+        if (states[i] == POINT_STATE_IN) {
+            inside.push_back(samples[i]);
+        }
+    }
+    if (inside.is_empty()) {
+        return 0.0;
+    }
+
+    const PackedFloat64Array depths = other.distances(inside);
+    double depth = 0.0;
+    for (int64_t i = 0; i < depths.size(); i++) {
+        depth = std::max(depth, depths[i]);
+    }
+    return depth;
+}
+
+Dictionary ocgd_SpatialQuery::interference(const Ref<ocgd_SpatialQuery>& other) const {
+    Dictionary result;
+    if (!is_built() || other.is_null() || !other->is_built()) {
+        UtilityFunctions::printerr("SpatialQuery: Cannot check interference - both query structures must be built");
+        return result;
+    }
+
+    try {
+        const ocgd_TriangleBVH& other_bvh = other->_bvh;
+        const double tolerance = Precision::Confusion();
+
+        // Broad phase over face boxes. Triangulations deviate from their surfaces by up to the
+        // deflection, so boxes are grown by it and the candidates also hold for exact checks.
+        const double margin = std::max(_has_surfaces ? _linear_deflection : 0.0,
+                                       other->_has_surfaces ? other->_linear_deflection : 0.0) + tolerance;
+        std::vector<FaceBox> boxes = face_boxes(_bvh, margin);
+        std::vector<FaceBox> other_boxes = face_boxes(other_bvh, margin);
+        std::vector<std::pair<int, int>> candidates = sweep_and_prune(boxes, other_boxes);
+        std::sort(candidates.begin(), candidates.end());
+
+        std::vector<int> candidate_faces;
+        for (const std::pair<int, int>& candidate : candidates) {
+            if (candidate_faces.empty() || candidate_faces.back() != candidate.first) {
+                candidate_faces.push_back(candidate.first);
+            }
+        }
+
+        // Triangles grouped by face
+        std::vector<int> face_first(_bvh.face_count() + 1, 0);
+        for (int t = 0; t < _bvh.triangle_count(); t++) {
+            face_first[_bvh.triangle_face(t) + 1]++;
+        }
+        for (int f = 0; f < _bvh.face_count(); f++) {
+            face_first[f + 1] += face_first[f];
+        }
+        std::vector<int> face_triangles(_bvh.triangle_count());
+        {
+            std::vector<int> cursor(face_first.begin(), face_first.end() - 1);
+            for (int t = 0; t < _bvh.triangle_count(); t++) {
+                face_triangles[cursor[_bvh.triangle_face(t)]++] = t;
+            }
+        }
+
+        // Narrow phase: each triangle of a candidate face against the other shape's triangles
+        // overlapping its box
+        struct FaceContacts {
+            std::vector<gp_Pnt> segments;
+            std::vector<int> other_faces;
+            std::vector<int> triangles;
+            std::vector<int> other_triangles;
+        };
+        std::vector<FaceContacts> contacts(candidate_faces.size());
+        ocgd_ParallelFor::run(static_cast<int>(candidate_faces.size()), _worker_count, [&](int index) {
+            const int face_index = candidate_faces[index];
+            FaceContacts& face_contacts = contacts[index];
+            std::vector<int> nearby;
+            for (int k = face_first[face_index]; k < face_first[face_index + 1]; k++) {
+                const int t = face_triangles[k];
+                const gp_Pnt a = _bvh.triangle_node(t, 0);
+                const gp_Pnt b = _bvh.triangle_node(t, 1);
+                const gp_Pnt c = _bvh.triangle_node(t, 2);
+                const gp_Pnt box_min(std::min(a.X(), std::min(b.X(), c.X())) - tolerance,
+                                     std::min(a.Y(), std::min(b.Y(), c.Y())) - tolerance,
+                                     std::min(a.Z(), std::min(b.Z(), c.Z())) - tolerance);
+                const gp_Pnt box_max(std::max(a.X(), std::max(b.X(), c.X())) + tolerance,
+                                     std::max(a.Y(), std::max(b.Y(), c.Y())) + tolerance,
+                                     std::max(a.Z(), std::max(b.Z(), c.Z())) + tolerance);
+                nearby.clear();
+                other_bvh.triangles_in_box(box_min, box_max, nearby);
+                for (int other_triangle : nearby) {
+                    gp_Pnt start, end;
+                    if (_bvh.intersect_triangle_pair(t, other_bvh, other_triangle, tolerance, start, end)) {
+                        face_contacts.segments.push_back(start);
+                        face_contacts.segments.push_back(end);
+                        face_contacts.other_faces.push_back(other_bvh.triangle_face(other_triangle));
+                        face_contacts.triangles.push_back(t);
+                        face_contacts.other_triangles.push_back(other_triangle);
+                    }
+                }
+            }
+            std::sort(face_contacts.other_faces.begin(), face_contacts.other_faces.end());
+            face_contacts.other_faces.erase(std::unique(face_contacts.other_faces.begin(), face_contacts.other_faces.end()),
+                                            face_contacts.other_faces.end());
+        });
+
+        PackedVector3Array segments;
+        PackedInt32Array face_pairs;
+        std::vector<int> crossing_triangles;
+        std::vector<int> other_crossing_triangles;
+        Bnd_Box contact_box;
+        for (size_t index = 0; index < contacts.size(); index++) {
+            const FaceContacts& face_contacts = contacts[index];
+            for (const gp_Pnt& point : face_contacts.segments) {
+                segments.push_back(to_vector3(point.XYZ()));
+                contact_box.Add(point);
+            }
+            for (int other_face : face_contacts.other_faces) {
+                face_pairs.push_back(candidate_faces[index]);
+                face_pairs.push_back(other_face);
+            }
+            crossing_triangles.insert(crossing_triangles.end(), face_contacts.triangles.begin(), face_contacts.triangles.end());
+            other_crossing_triangles.insert(other_crossing_triangles.end(), face_contacts.other_triangles.begin(),
+                                            face_contacts.other_triangles.end());
+        }
+        for (std::vector<int>* triangles : {&crossing_triangles, &other_crossing_triangles}) {
+            std::sort(triangles->begin(), triangles->end());
+            triangles->erase(std::unique(triangles->begin(), triangles->end()), triangles->end());
+        }
+
+        PackedInt32Array candidate_pairs;
+        candidate_pairs.resize(static_cast<int64_t>(candidates.size()) * 2);
+        for (size_t i = 0; i < candidates.size(); i++) {
+            candidate_pairs.set(i * 2, candidates[i].first);
+            candidate_pairs.set(i * 2 + 1, candidates[i].second);
+        }
+
+        // Without crossings, one shape may still lie entirely inside the other
+        bool inside_other = false;
+        bool contains_other = false;
+        if (segments.is_empty()) {
+            PackedVector3Array probe;
+            probe.push_back(to_vector3(_bvh.triangle_node(0, 0).XYZ()));
+            inside_other = other->classify_points(probe, tolerance, true)[0] == POINT_STATE_IN;
+            probe.set(0, to_vector3(other_bvh.triangle_node(0, 0).XYZ()));
+            contains_other = classify_points(probe, tolerance, true)[0] == POINT_STATE_IN;
+        }
+        const bool interferes = !segments.is_empty() || inside_other || contains_other;
+
+        double depth = 0.0;
+        if (interferes) {
+            const double spacing = contact_box.IsVoid() ? 0.0 : std::sqrt(contact_box.SquareExtent()) * PENETRATION_SAMPLE_RATIO;
+            depth = std::max(penetration_depth(crossing_triangles, spacing, *other.ptr()),
+                             other->penetration_depth(other_crossing_triangles, spacing, *this));
+        }
+
+        result["interferes"] = interferes;
+        result["contact_segments"] = segments;
+        result["face_pairs"] = face_pairs;
+        result["candidate_face_pairs"] = candidate_pairs;
+        result["inside_other"] = inside_other;
+        result["contains_other"] = contains_other;
+        result["penetration_depth"] = depth;
+
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception checking interference - " + String(e.GetMessageString()));
+        result.clear();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("SpatialQuery: Exception checking interference - " + String(e.what()));
+        result.clear();
+    }
+
+    return result;
+}
@@ -0,0 +1,220 @@
+#ifndef _ocgd_SpatialQuery_HeaderFile
+#define _ocgd_SpatialQuery_HeaderFile
+
+/**
+ * ocgd_SpatialQuery.hxx
+ *
+ * Godot GDExtension spatial query structure for repeated point and ray queries on a shape.
+ *
+ * Single-point helpers such as ocgd_shape::distance_to_point or
+ * ocgd_TopologyAnalyzer::distance_point_to_shape run a full BRepExtrema_DistShapeShape per
+ * call. This class triangulates the shape once and keeps its triangles in a bounding volume
+ * hierarchy (ocgd_TriangleBVH) tagged with their B-rep face, then answers whole batches of
+ * closest-point, distance and ray queries in parallel. Results can optionally be refined
+ * from the triangulation onto the exact face surfaces.
+ *
+ * Points can also be classified against the solid in batches: the solid classifier is
+ * prepared once per worker and reused across calls, and an optional ray-parity test on
+ * the triangle hierarchy settles most points without touching the exact geometry.
+ *
+ * Wall thickness is measured from every triangulation vertex along the inward normal,
+ * giving per-vertex values for heat maps and percentile statistics for DFM checks.
+ * Two queries can be checked for interference, pruning face pairs by their bounding
+ * boxes before intersecting triangles.
+ *
+ * Both binding flavours are accepted:
+ * - ocgd_TopoDS_Shape (this module)
+ * - ocgd_shape (ai_bindings4)
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_float64_array.hpp>
+#include <godot_cpp/variant/packed_vector3_array.hpp>
+
+#include <opencascade/BRepClass3d_SolidClassifier.hxx>
+#include <opencascade/TopoDS_Shape.hxx>
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ocgd_TopoDS_Shape.hxx"
+#include "ocgd_TriangleBVH.hxx"
+#include "../ai_bindings4/ocgd_shape.h"
+
+using namespace godot;
+
+/**
+ * ocgd_SpatialQuery
+ *
+ * Batched closest-point, distance and ray queries against one shape.
+ *
+ * Typical usage:
+ *   var query = ocgd_SpatialQuery.new()
+ *   query.build(shape)
+ *   var result = query.closest_points(probe_points)
+ *   var faces = result["face_indices"]
+ */
+class ocgd_SpatialQuery : public RefCounted {
+    GDCLASS(ocgd_SpatialQuery, RefCounted);
+
+public:
+    /**
+     * @brief Point classification states, with the values of TopAbs_State
+     */
+    enum PointState {
+        POINT_STATE_IN = 0,       ///< Inside the solid
+        POINT_STATE_OUT = 1,      ///< Outside the solid
+        POINT_STATE_ON = 2,       ///< On the boundary, within the tolerance
+        POINT_STATE_UNKNOWN = 3   ///< Could not be classified
+    };
+
+protected:
+    static void _bind_methods();
+
+private:
+    double _linear_deflection;
+    double _angular_deflection;
+    bool _refine_to_surface;
+    int _worker_count;
+
+    ocgd_TriangleBVH _bvh;
+
+    //! Parameter bounds per face, for faces with a surface that results can be refined onto
+    struct FaceBounds {
+        double u_min = 0.0;
+        double u_max = 0.0;
+        double v_min = 0.0;
+        double v_max = 0.0;
+        bool refinable = false;
+    };
+    std::vector<FaceBounds> _face_bounds;
+
+    //! Built shape, and whether it has surfaces for exact classification
+    TopoDS_Shape _shape;
+    bool _has_surfaces;
+
+    //! Prepared solid classifiers kept across calls. A classifier keeps per-query state,
+    //! so each is used by one worker at a time and returned here afterwards.
+    mutable std::mutex _classifier_mutex;
+    mutable std::vector<std::unique_ptr<BRepClass3d_SolidClassifier>> _classifiers;
+
+    //! Internal helpers to borrow a prepared classifier and give it back
+    std::unique_ptr<BRepClass3d_SolidClassifier> acquire_classifier() const;
+    void release_classifier(std::unique_ptr<BRepClass3d_SolidClassifier> classifier) const;
+
+    //! Internal helper to classify a point by the parity of triangle crossings;
+    //! returns POINT_STATE_UNKNOWN if every ray passed too close to a triangle edge
+    PointState classify_by_parity(const gp_Pnt& point, double tolerance) const;
+
+    //! Internal helper to refine a ray hit onto the exact surface of its face when enabled;
+    //! returns the unit normal at the hit, oriented like the face
+    template <typename Cache>
+    gp_Vec refine_ray_hit(const gp_Pnt& origin, const gp_Vec& direction, double max_distance,
+                          ocgd_TriangleBVH::TrianglePoint& hit, Cache& surfaces) const;
+
+    //! Internal helper for the deepest point of this shape's boundary inside another shape,
+    //! sampled at the vertices and on a grid of the given spacing over crossing triangles
+    double penetration_depth(const std::vector<int>& crossing_triangles, double sample_spacing,
+                             const ocgd_SpatialQuery& other) const;
+
+    //! Internal helper to run a query for each element of a batch in parallel
+    template <typename Functor>
+    void run_batch(int64_t count, const Functor& functor) const;
+
+public:
+    //! Default constructor
+    ocgd_SpatialQuery();
+
+    //! Destructor
+    virtual ~ocgd_SpatialQuery();
+
+    // === Settings ===
+
+    //! Set linear deflection used to triangulate shapes that are not meshed finely enough
+    void set_linear_deflection(double deflection);
+    double get_linear_deflection() const;
+
+    //! Set angular deflection (radians) used to triangulate shapes
+    void set_angular_deflection(double deflection);
+    double get_angular_deflection() const;
+
+    //! Set whether query results are refined from the triangulation onto the exact surfaces
+    void set_refine_to_surface(bool refine);
+    bool get_refine_to_surface() const;
+
+    //! Set the number of worker threads used to build and query (0 = one per core)
+    void set_worker_count(int count);
+    int get_worker_count() const;
+
+    // === Building ===
+
+    //! Triangulate a shape if needed and build the query structure from it
+    //! Returns false if the shape is null or has no triangles
+    bool build(const Ref<ocgd_TopoDS_Shape>& shape);
+
+    //! Same as build, for shapes of the ocgd_shape bindings
+    bool build_from_shape(const Ref<ocgd_shape>& shape);
+
+    //! Build the query structure from an OpenCASCADE shape (C++ only)
+    bool build_occt_shape(const TopoDS_Shape& shape);
+
+    //! Release the query structure
+    void clear();
+
+    //! Check whether a shape has been built
+    bool is_built() const;
+
+    //! Get the number of triangles in the query structure
+    int get_triangle_count() const;
+
+    //! Get the number of faces of the built shape
+    int get_face_count() const;
+
+    // === Queries ===
+
+    //! Find the closest point on the shape for each point.
+    //! Returns "points", "normals", "distances" and "face_indices" arrays; points farther
+    //! than max_distance (if positive) get face index -1 and distance -1.
+    Dictionary closest_points(const PackedVector3Array& points, double max_distance = 0.0) const;
+
+    //! Distance from each point to the shape, -1 beyond max_distance (if positive)
+    PackedFloat64Array distances(const PackedVector3Array& points, double max_distance = 0.0) const;
+
+    //! Cast one ray per origin/direction pair and return the first hit of each.
+    //! Returns "points", "normals", "distances" and "face_indices" arrays; rays that hit
+    //! nothing within max_distance (if positive) get face index -1 and distance -1.
+    Dictionary intersect_rays(const PackedVector3Array& origins, const PackedVector3Array& directions,
+                              double max_distance = 0.0) const;
+
+    //! Classify each point against the solid (one PointState per point).
+    //! With ray_parity, points are classified on the triangulation by counting ray crossings,
+    //! falling back to the exact classifier only where that is ambiguous.
+    PackedByteArray classify_points(const PackedVector3Array& points, double tolerance = 1e-7,
+                                    bool ray_parity = false) const;
+
+    //! Measure the wall thickness at every triangulation vertex by casting a ray along the
+    //! inward normal to the opposite wall. Returns the "vertices", "normals" and "triangles"
+    //! of the triangulation with per-vertex "thickness" (-1 where no wall is found within
+    //! max_thickness, if positive) and "face_indices", plus summary statistics.
+    Dictionary wall_thickness(double max_thickness = 0.0) const;
+
+    //! Check the built shape for interference with the shape built in another query.
+    //! Face bounding boxes are swept and pruned first, then triangles of candidate faces are
+    //! intersected. Returns "interferes", the crossing "contact_segments", the interfering
+    //! "face_pairs", the broad-phase "candidate_face_pairs", containment flags and
+    //! "penetration_depth".
+    Dictionary interference(const Ref<ocgd_SpatialQuery>& other) const;
+
+    //! Triangle hierarchy of the built shape (C++ only)
+    const ocgd_TriangleBVH& get_bvh() const;
+};
+
+VARIANT_ENUM_CAST(ocgd_SpatialQuery::PointState);
+
+#endif // _ocgd_SpatialQuery_HeaderFile
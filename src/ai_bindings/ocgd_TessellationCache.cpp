@@ -0,0 +1,539 @@
+/**
+ * ocgd_TessellationCache.cpp
+ *
+ * Godot GDExtension persistent on-disk cache for extracted mesh data implementation.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_TessellationCache.hxx"
+
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+#include <godot_cpp/variant/packed_string_array.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include <opencascade/BRepTools.hxx>
+#include <opencascade/Standard_Failure.hxx>
+#include <opencascade/TopTools_FormatVersion.hxx>
+
+#include <algorithm>
+#include <cstdio>
+#include <ostream>
+#include <streambuf>
+#include <utility>
+#include <vector>
+
+using namespace godot;
+
+namespace {
+
+// Blob layout: magic, format version, payload size, var_to_bytes payload
+const uint32_t CACHE_BLOB_MAGIC = 0x4354434F; // "OCTC"
+const uint32_t CACHE_BLOB_VERSION = 1;
+const int64_t CACHE_BLOB_HEADER_SIZE = 16;
+
+const char* CACHE_ENTRY_EXTENSION = "ocmesh";
+const char* CACHE_INDEX_FILE = "index.json";
+
+// Bumped whenever the extracted mesh data layout changes, invalidating old keys
+const char* CACHE_KEY_SALT = "ocgd-tessellation-v1";
+
+/**
+ * Output streambuf that hashes everything written to it instead of storing it,
+ * so the BRep serialization of large shapes never has to be held in memory.
+ * Two independent 64-bit hashes are combined into a 128-bit key.
+ */
+class ocgd_HashingStreamBuf : public std::streambuf {
+public:
+    void consume(const char* data, std::size_t size) {
+        for (std::size_t i = 0; i < size; i++) {
+            const uint64_t byte = static_cast<unsigned char>(data[i]);
+            _fnv = (_fnv ^ byte) * 1099511628211ULL;
+            _mix = (_mix ^ byte) * 0xff51afd7ed558ccdULL;
+            _mix ^= _mix >> 29;
+        }
+    }
+
+    String hex_digest() const {
+        char digest[33];
+        std::snprintf(digest, sizeof(digest), "%016llx%016llx",
+                      static_cast<unsigned long long>(_fnv), static_cast<unsigned long long>(_mix));
+        return String(digest);
+    }
+
+protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            consume(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        consume(data, static_cast<std::size_t>(size));
+        return size;
+    }
+
+private:
+    uint64_t _fnv = 14695981039346656037ULL;
+    uint64_t _mix = 0x9e3779b97f4a7c15ULL;
+};
+
+} // namespace
+
+void ocgd_TessellationCache::_bind_methods() {
+    // Settings
+    ClassDB::bind_method(D_METHOD("set_cache_directory", "directory"), &ocgd_TessellationCache::set_cache_directory);
+    ClassDB::bind_method(D_METHOD("get_cache_directory"), &ocgd_TessellationCache::get_cache_directory);
+    ClassDB::bind_method(D_METHOD("set_max_size_bytes", "max_size"), &ocgd_TessellationCache::set_max_size_bytes);
+    ClassDB::bind_method(D_METHOD("get_max_size_bytes"), &ocgd_TessellationCache::get_max_size_bytes);
+    ClassDB::bind_method(D_METHOD("set_max_entries", "max_entries"), &ocgd_TessellationCache::set_max_entries);
+    ClassDB::bind_method(D_METHOD("get_max_entries"), &ocgd_TessellationCache::get_max_entries);
+
+    // Cache operations
+    ClassDB::bind_method(D_METHOD("compute_key", "shape", "linear_deflection", "angular_deflection", "relative", "extra_parameters"),
+                         &ocgd_TessellationCache::compute_key, DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("has_mesh_data", "key"), &ocgd_TessellationCache::has_mesh_data);
+    ClassDB::bind_method(D_METHOD("load_mesh_data", "key"), &ocgd_TessellationCache::load_mesh_data);
+    ClassDB::bind_method(D_METHOD("store_mesh_data", "key", "mesh_data"), &ocgd_TessellationCache::store_mesh_data);
+    ClassDB::bind_method(D_METHOD("clear"), &ocgd_TessellationCache::clear);
+    ClassDB::bind_method(D_METHOD("flush"), &ocgd_TessellationCache::flush);
+
+    // Statistics
+    ClassDB::bind_method(D_METHOD("get_total_size"), &ocgd_TessellationCache::get_total_size);
+    ClassDB::bind_method(D_METHOD("get_entry_count"), &ocgd_TessellationCache::get_entry_count);
+    ClassDB::bind_method(D_METHOD("get_hit_count"), &ocgd_TessellationCache::get_hit_count);
+    ClassDB::bind_method(D_METHOD("get_miss_count"), &ocgd_TessellationCache::get_miss_count);
+
+    ClassDB::add_property("ocgd_TessellationCache", PropertyInfo(Variant::STRING, "cache_directory"), "set_cache_directory", "get_cache_directory");
+    ClassDB::add_property("ocgd_TessellationCache", PropertyInfo(Variant::INT, "max_size_bytes"), "set_max_size_bytes", "get_max_size_bytes");
+    ClassDB::add_property("ocgd_TessellationCache", PropertyInfo(Variant::INT, "max_entries"), "set_max_entries", "get_max_entries");
+}
+
+ocgd_TessellationCache::ocgd_TessellationCache() :
+    _cache_directory("user://ocgd_tessellation_cache"),
+    _max_size_bytes(int64_t(1024) * 1024 * 1024),
+    _max_entries(10000),
+    _total_size(0),
+    _access_clock(0),
+    _index_loaded(false),
+    _index_dirty(false),
+    _hit_count(0),
+    _miss_count(0) {
+}
+
+ocgd_TessellationCache::~ocgd_TessellationCache() {
+    flush();
+}
+
+// Settings
+
+void ocgd_TessellationCache::set_cache_directory(const String& directory) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (directory == _cache_directory) {
+        return;
+    }
+
+    if (_index_loaded && _index_dirty) {
+        save_index();
+    }
+
+    _cache_directory = directory;
+    _entries.clear();
+    _total_size = 0;
+    _access_clock = 0;
+    _index_loaded = false;
+    _index_dirty = false;
+}
+
+String ocgd_TessellationCache::get_cache_directory() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _cache_directory;
+}
+
+void ocgd_TessellationCache::set_max_size_bytes(int64_t max_size) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_size_bytes = std::max<int64_t>(0, max_size);
+}
+
+int64_t ocgd_TessellationCache::get_max_size_bytes() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _max_size_bytes;
+}
+
+void ocgd_TessellationCache::set_max_entries(int max_entries) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_entries = std::max(0, max_entries);
+}
+
+int ocgd_TessellationCache::get_max_entries() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _max_entries;
+}
+
+// Cache operations
+
+String ocgd_TessellationCache::compute_key(const Ref<ocgd_TopoDS_Shape>& shape, double linear_deflection,
+                                           double angular_deflection, bool relative,
+                                           const Dictionary& extra_parameters) const {
+    if (shape.is_null() || shape->is_null()) {
+        UtilityFunctions::printerr("TessellationCache: Cannot compute key - shape is null");
+        return String();
+    }
+
+    try {
+        ocgd_HashingStreamBuf hash_buffer;
+        std::ostream hash_stream(&hash_buffer);
+
+        hash_stream << CACHE_KEY_SALT << '\n';
+
+        // Geometry and topology only; any triangulation already attached must not change the key
+        BRepTools::Write(shape->get_occt_shape(), hash_stream, Standard_False, Standard_False,
+                         TopTools_FormatVersion_CURRENT);
+
+        char parameters[128];
+        std::snprintf(parameters, sizeof(parameters), "\nlinear=%.17g;angular=%.17g;relative=%d\n",
+                      linear_deflection, angular_deflection, relative ? 1 : 0);
+        hash_stream << parameters;
+
+        // Sort keys so the key does not depend on Dictionary insertion order
+        Array keys = extra_parameters.keys();
+        keys.sort();
+        for (int i = 0; i < keys.size(); i++) {
+            const String entry = UtilityFunctions::var_to_str(keys[i]) + "=" +
+                                 UtilityFunctions::var_to_str(extra_parameters[keys[i]]) + ";";
+            const CharString entry_utf8 = entry.utf8();
+            hash_stream.write(entry_utf8.get_data(), entry_utf8.length());
+        }
+        hash_stream.flush();
+
+        return hash_buffer.hex_digest();
+    } catch (const Standard_Failure& e) {
+        UtilityFunctions::printerr("TessellationCache: Exception computing key - " + String(e.GetMessageString()));
+        return String();
+    } catch (const std::exception& e) {
+        UtilityFunctions::printerr("TessellationCache: Exception computing key - " + String(e.what()));
+        return String();
+    }
+}
+
+bool ocgd_TessellationCache::has_mesh_data(const String& key) {
+    if (!key.is_valid_hex_number(false)) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+    return _entries.find(key.utf8().get_data()) != _entries.end();
+}
+
+Dictionary ocgd_TessellationCache::load_mesh_data(const String& key) {
+    if (!key.is_valid_hex_number(false)) {
+        UtilityFunctions::printerr("TessellationCache: Cannot load - invalid key '" + key + "'");
+        return Dictionary();
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+
+    const std::string entry_key = key.utf8().get_data();
+    auto it = _entries.find(entry_key);
+    if (it == _entries.end()) {
+        _miss_count++;
+        return Dictionary();
+    }
+
+    Ref<FileAccess> file = FileAccess::open(entry_path(key), FileAccess::READ);
+    if (file.is_null()) {
+        remove_entry(entry_key);
+        _miss_count++;
+        return Dictionary();
+    }
+
+    const uint32_t magic = file->get_32();
+    const uint32_t version = file->get_32();
+    const int64_t payload_size = static_cast<int64_t>(file->get_64());
+    if (magic != CACHE_BLOB_MAGIC || version != CACHE_BLOB_VERSION ||
+        payload_size <= 0 || payload_size != static_cast<int64_t>(file->get_length()) - CACHE_BLOB_HEADER_SIZE) {
+        UtilityFunctions::printerr("TessellationCache: Discarding corrupt entry '" + key + "'");
+        file.unref();
+        remove_entry(entry_key);
+        _miss_count++;
+        return Dictionary();
+    }
+
+    const PackedByteArray payload = file->get_buffer(payload_size);
+    const Variant mesh_data = UtilityFunctions::bytes_to_var(payload);
+    if (mesh_data.get_type() != Variant::DICTIONARY) {
+        UtilityFunctions::printerr("TessellationCache: Discarding unreadable entry '" + key + "'");
+        file.unref();
+        remove_entry(entry_key);
+        _miss_count++;
+        return Dictionary();
+    }
+
+    it->second.last_used = ++_access_clock;
+    _index_dirty = true;
+    _hit_count++;
+    return mesh_data;
+}
+
+bool ocgd_TessellationCache::store_mesh_data(const String& key, const Dictionary& mesh_data) {
+    if (!key.is_valid_hex_number(false)) {
+        UtilityFunctions::printerr("TessellationCache: Cannot store - invalid key '" + key + "'");
+        return false;
+    }
+
+    if (mesh_data.is_empty()) {
+        UtilityFunctions::printerr("TessellationCache: Cannot store - mesh data is empty");
+        return false;
+    }
+
+    const PackedByteArray payload = UtilityFunctions::var_to_bytes(mesh_data);
+    const int64_t blob_size = CACHE_BLOB_HEADER_SIZE + payload.size();
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+
+    // A single blob larger than the whole cache would only evict everything else
+    if (_max_size_bytes > 0 && blob_size > _max_size_bytes) {
+        return false;
+    }
+
+    // Write to a temporary file first so readers never see a partially written blob
+    const String path = entry_path(key);
+    const String temp_path = path + ".tmp";
+    {
+        Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+        if (file.is_null()) {
+            UtilityFunctions::printerr("TessellationCache: Cannot write entry '" + temp_path + "'");
+            return false;
+        }
+        file->store_32(CACHE_BLOB_MAGIC);
+        file->store_32(CACHE_BLOB_VERSION);
+        file->store_64(static_cast<uint64_t>(payload.size()));
+        file->store_buffer(payload);
+    }
+
+    if (DirAccess::rename_absolute(temp_path, path) != OK) {
+        UtilityFunctions::printerr("TessellationCache: Cannot finalize entry '" + path + "'");
+        DirAccess::remove_absolute(temp_path);
+        return false;
+    }
+
+    const std::string entry_key = key.utf8().get_data();
+    CacheEntry& entry = _entries[entry_key];
+    _total_size += blob_size - entry.size;
+    entry.size = blob_size;
+    entry.last_used = ++_access_clock;
+    _index_dirty = true;
+
+    evict_to_limits(entry_key);
+    return true;
+}
+
+void ocgd_TessellationCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+
+    const PackedStringArray files = DirAccess::get_files_at(_cache_directory);
+    for (int i = 0; i < files.size(); i++) {
+        const String extension = files[i].get_extension();
+        if (extension == CACHE_ENTRY_EXTENSION || extension == "tmp") {
+            DirAccess::remove_absolute(_cache_directory.path_join(files[i]));
+        }
+    }
+
+    _entries.clear();
+    _total_size = 0;
+    _access_clock = 0;
+    _index_dirty = true;
+    save_index();
+}
+
+void ocgd_TessellationCache::flush() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_index_loaded && _index_dirty) {
+        save_index();
+    }
+}
+
+// Statistics
+
+int64_t ocgd_TessellationCache::get_total_size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+    return _total_size;
+}
+
+int ocgd_TessellationCache::get_entry_count() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ensure_index_loaded();
+    return static_cast<int>(_entries.size());
+}
+
+int ocgd_TessellationCache::get_hit_count() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _hit_count;
+}
+
+int ocgd_TessellationCache::get_miss_count() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _miss_count;
+}
+
+// Private helper methods (called with _mutex held)
+
+String ocgd_TessellationCache::entry_path(const String& key) const {
+    return _cache_directory.path_join(key + "." + CACHE_ENTRY_EXTENSION);
+}
+
+String ocgd_TessellationCache::index_path() const {
+    return _cache_directory.path_join(CACHE_INDEX_FILE);
+}
+
+void ocgd_TessellationCache::ensure_index_loaded() {
+    if (_index_loaded) {
+        return;
+    }
+    _index_loaded = true;
+
+    if (!DirAccess::dir_exists_absolute(_cache_directory)) {
+        if (DirAccess::make_dir_recursive_absolute(_cache_directory) != OK) {
+            UtilityFunctions::printerr("TessellationCache: Cannot create cache directory '" + _cache_directory + "'");
+        }
+        return;
+    }
+
+    // Last-used ticks from the index file, if present and readable
+    if (FileAccess::file_exists(index_path())) {
+        const Variant parsed = JSON::parse_string(FileAccess::get_file_as_string(index_path()));
+        if (parsed.get_type() == Variant::DICTIONARY) {
+            const Dictionary index = parsed;
+            _access_clock = static_cast<uint64_t>(double(index.get("clock", 0.0)));
+
+            const Dictionary entries = index.get("entries", Dictionary());
+            const Array keys = entries.keys();
+            for (int i = 0; i < keys.size(); i++) {
+                const Array values = entries[keys[i]];
+                if (values.size() != 2) {
+                    continue;
+                }
+                CacheEntry entry;
+                entry.size = static_cast<int64_t>(double(values[0]));
+                entry.last_used = static_cast<uint64_t>(double(values[1]));
+                _entries[String(keys[i]).utf8().get_data()] = entry;
+            }
+        } else {
+            UtilityFunctions::printerr("TessellationCache: Ignoring unreadable index, rebuilding from directory");
+        }
+    }
+
+    // Reconcile with the blobs actually on disk: other cache instances may have added
+    // entries after the index was written, and entries may have been deleted externally
+    std::unordered_map<std::string, CacheEntry> reconciled;
+    const PackedStringArray files = DirAccess::get_files_at(_cache_directory);
+    for (int i = 0; i < files.size(); i++) {
+        if (files[i].get_extension() != CACHE_ENTRY_EXTENSION) {
+            continue;
+        }
+
+        const std::string entry_key = files[i].get_basename().utf8().get_data();
+        auto it = _entries.find(entry_key);
+        if (it != _entries.end()) {
+            reconciled[entry_key] = it->second;
+            continue;
+        }
+
+        Ref<FileAccess> file = FileAccess::open(_cache_directory.path_join(files[i]), FileAccess::READ);
+        if (file.is_valid()) {
+            CacheEntry entry;
+            entry.size = static_cast<int64_t>(file->get_length());
+            entry.last_used = 0; // Unknown use, evicted first
+            reconciled[entry_key] = entry;
+            _index_dirty = true;
+        }
+    }
+
+    if (reconciled.size() != _entries.size()) {
+        _index_dirty = true;
+    }
+    _entries.swap(reconciled);
+
+    _total_size = 0;
+    for (const auto& entry : _entries) {
+        _total_size += entry.second.size;
+        _access_clock = std::max(_access_clock, entry.second.last_used);
+    }
+}
+
+void ocgd_TessellationCache::save_index() {
+    Dictionary entries;
+    for (const auto& entry : _entries) {
+        Array values;
+        values.append(entry.second.size);
+        values.append(static_cast<int64_t>(entry.second.last_used));
+        entries[String::utf8(entry.first.c_str())] = values;
+    }
+
+    Dictionary index;
+    index["version"] = static_cast<int64_t>(CACHE_BLOB_VERSION);
+    index["clock"] = static_cast<int64_t>(_access_clock);
+    index["entries"] = entries;
+
+    if (!DirAccess::dir_exists_absolute(_cache_directory)) {
+        DirAccess::make_dir_recursive_absolute(_cache_directory);
+    }
+
+    Ref<FileAccess> file = FileAccess::open(index_path(), FileAccess::WRITE);
+    if (file.is_null()) {
+        UtilityFunctions::printerr("TessellationCache: Cannot write index '" + index_path() + "'");
+        return;
+    }
+    file->store_string(JSON::stringify(index));
+    _index_dirty = false;
+}
+
+void ocgd_TessellationCache::evict_to_limits(const std::string& keep_key) {
+    const bool over_size = _max_size_bytes > 0 && _total_size > _max_size_bytes;
+    const bool over_count = _max_entries > 0 && static_cast<int>(_entries.size()) > _max_entries;
+    if (!over_size && !over_count) {
+        return;
+    }
+
+    std::vector<std::pair<uint64_t, std::string>> candidates;
+    candidates.reserve(_entries.size());
+    for (const auto& entry : _entries) {
+        if (entry.first != keep_key) {
+            candidates.emplace_back(entry.second.last_used, entry.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto& candidate : candidates) {
+        const bool size_ok = _max_size_bytes <= 0 || _total_size <= _max_size_bytes;
+        const bool count_ok = _max_entries <= 0 || static_cast<int>(_entries.size()) <= _max_entries;
+        if (size_ok && count_ok) {
+            break;
+        }
+        remove_entry(candidate.second);
+    }
+}
+
+void ocgd_TessellationCache::remove_entry(const std::string& key) {
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        return;
+    }
+
+    DirAccess::remove_absolute(entry_path(String::utf8(key.c_str())));
+    _total_size -= it->second.size;
+    _entries.erase(it);
+    _index_dirty = true;
+}
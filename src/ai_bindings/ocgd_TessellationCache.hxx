@@ -0,0 +1,143 @@
+#ifndef _ocgd_TessellationCache_HeaderFile
+#define _ocgd_TessellationCache_HeaderFile
+
+/**
+ * ocgd_TessellationCache.hxx
+ *
+ * Godot GDExtension persistent on-disk cache for extracted mesh data.
+ *
+ * Meshing a shape with BRepMesh_IncrementalMesh and extracting its triangulation is the
+ * most expensive step of an import. This cache stores the extracted mesh data Dictionary
+ * (as produced by ocgd_MeshDataExtractor) in a compact binary blob, keyed by a hash of the
+ * shape's BRep content and the meshing parameters, so that reimporting unchanged geometry
+ * skips both steps.
+ *
+ * The cache features:
+ * - Stable content keys independent of shape object identity
+ * - Least-recently-used eviction bounded by total size and entry count
+ * - An index file that is reconciled with the directory contents on first use, so
+ *   entries written by other cache instances are picked up instead of leaked
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include <godot_cpp/classes/ref_counted.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ocgd_TopoDS_Shape.hxx"
+
+using namespace godot;
+
+/**
+ * ocgd_TessellationCache
+ *
+ * Persistent mesh data cache with LRU eviction.
+ *
+ * Typical usage:
+ *   var key = cache.compute_key(shape, linear_deflection, angular_deflection, relative, options)
+ *   var mesh_data = cache.load_mesh_data(key)
+ *   if mesh_data.is_empty():
+ *       mesh_data = <mesh and extract>
+ *       cache.store_mesh_data(key, mesh_data)
+ */
+class ocgd_TessellationCache : public RefCounted {
+    GDCLASS(ocgd_TessellationCache, RefCounted);
+
+protected:
+    static void _bind_methods();
+
+private:
+    struct CacheEntry {
+        int64_t size = 0;
+        uint64_t last_used = 0;
+    };
+
+    String _cache_directory;
+    int64_t _max_size_bytes;
+    int _max_entries;
+
+    // Index state, loaded lazily from the cache directory
+    mutable std::mutex _mutex;
+    std::unordered_map<std::string, CacheEntry> _entries;
+    int64_t _total_size;
+    uint64_t _access_clock;
+    bool _index_loaded;
+    bool _index_dirty;
+
+    int _hit_count;
+    int _miss_count;
+
+    String entry_path(const String& key) const;
+    String index_path() const;
+
+    void ensure_index_loaded();
+    void save_index();
+    void evict_to_limits(const std::string& keep_key);
+    void remove_entry(const std::string& key);
+
+public:
+    //! Default constructor
+    ocgd_TessellationCache();
+
+    //! Destructor, writes pending index changes
+    virtual ~ocgd_TessellationCache();
+
+    // === Settings ===
+
+    //! Set directory holding the cache (created on demand, res:// and user:// paths allowed)
+    void set_cache_directory(const String& directory);
+    String get_cache_directory() const;
+
+    //! Set maximum total size of cached blobs in bytes (0 = unlimited)
+    void set_max_size_bytes(int64_t max_size);
+    int64_t get_max_size_bytes() const;
+
+    //! Set maximum number of cached entries (0 = unlimited)
+    void set_max_entries(int max_entries);
+    int get_max_entries() const;
+
+    // === Cache Operations ===
+
+    //! Compute the cache key of a shape meshed with the given parameters
+    //! extra_parameters holds any further settings affecting the cached data (e.g. extraction options)
+    String compute_key(const Ref<ocgd_TopoDS_Shape>& shape, double linear_deflection, double angular_deflection,
+                       bool relative, const Dictionary& extra_parameters = Dictionary()) const;
+
+    //! Check whether an entry exists for the key
+    bool has_mesh_data(const String& key);
+
+    //! Load cached mesh data, returns an empty Dictionary on a miss
+    Dictionary load_mesh_data(const String& key);
+
+    //! Store mesh data under the key, evicting least recently used entries as needed
+    bool store_mesh_data(const String& key, const Dictionary& mesh_data);
+
+    //! Remove all cached entries
+    void clear();
+
+    //! Write pending index changes to disk
+    void flush();
+
+    // === Statistics ===
+
+    //! Total size of cached blobs in bytes
+    int64_t get_total_size();
+
+    //! Number of cached entries
+    int get_entry_count();
+
+    //! Number of successful loads since creation
+    int get_hit_count() const;
+
+    //! Number of failed loads since creation
+    int get_miss_count() const;
+};
+
+#endif // _ocgd_TessellationCache_HeaderFile
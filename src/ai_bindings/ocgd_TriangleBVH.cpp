@@ -0,0 +1,790 @@
+/**
+ * ocgd_TriangleBVH.cpp
+ *
+ * Triangle bounding volume hierarchy implementation.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#include "ocgd_TriangleBVH.hxx"
+#include "ocgd_ParallelFor.hxx"
+
+#include <opencascade/BRep_Tool.hxx>
+#include <opencascade/Poly_Triangle.hxx>
+#include <opencascade/TopExp_Explorer.hxx>
+#include <opencascade/TopLoc_Location.hxx>
+#include <opencascade/TopoDS.hxx>
+#include <opencascade/gp_Trsf.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+// Leaves hold at most this many triangles
+const int MAX_LEAF_SIZE = 4;
+
+// Traversal stack size; median splits keep the depth near log2 of the triangle count
+const int MAX_STACK_DEPTH = 96;
+
+inline void sub(const double* a, const double* b, double* out) {
+    out[0] = a[0] - b[0];
+    out[1] = a[1] - b[1];
+    out[2] = a[2] - b[2];
+}
+
+inline double dot(const double* a, const double* b) {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+inline void cross(const double* a, const double* b, double* out) {
+    out[0] = a[1] * b[2] - a[2] * b[1];
+    out[1] = a[2] * b[0] - a[0] * b[2];
+    out[2] = a[0] * b[1] - a[1] * b[0];
+}
+
+// Squared distance from a point to an axis-aligned box, 0 inside
+inline double box_distance_squared(const double* min, const double* max, const double* p) {
+    double distance = 0.0;
+    for (int k = 0; k < 3; k++) {
+        const double d = p[k] < min[k] ? min[k] - p[k] : (p[k] > max[k] ? p[k] - max[k] : 0.0);
+        distance += d * d;
+    }
+    return distance;
+}
+
+// Entry distance of a ray into a box within [t_min, t_max], or infinity if it misses
+inline double box_ray_entry(const double* min, const double* max, const double* origin, const double* inverse_direction,
+                            double t_min, double t_max) {
+    for (int k = 0; k < 3; k++) {
+        // A ray parallel to the slab is either inside it over its whole length or misses the box;
+        // the products below would be NaN for an origin on the slab
+        if (std::isinf(inverse_direction[k])) {
+            if (origin[k] < min[k] || origin[k] > max[k]) {
+                return std::numeric_limits<double>::infinity();
+            }
+            continue;
+        }
+        double t0 = (min[k] - origin[k]) * inverse_direction[k];
+        double t1 = (max[k] - origin[k]) * inverse_direction[k];
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        if (t0 > t_min) {
+            t_min = t0;
+        }
+        if (t1 < t_max) {
+            t_max = t1;
+        }
+        if (t_min > t_max) {
+            return std::numeric_limits<double>::infinity();
+        }
+    }
+    return t_min;
+}
+
+// Closest point on triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5),
+// returned as the weights v, w of b and c
+void closest_on_triangle(const double* p, const double* a, const double* b, const double* c, double& v, double& w) {
+    double ab[3], ac[3], ap[3];
+    sub(b, a, ab);
+    sub(c, a, ac);
+    sub(p, a, ap);
+    const double d1 = dot(ab, ap);
+    const double d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        v = 0.0;
+        w = 0.0;
+        return;
+    }
+
+    double bp[3];
+    sub(p, b, bp);
+    const double d3 = dot(ab, bp);
+    const double d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        v = 1.0;
+        w = 0.0;
+        return;
+    }
+
+    const double vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        v = d1 / (d1 - d3);
+        w = 0.0;
+        return;
+    }
+
+    double cp[3];
+    sub(p, c, cp);
+    const double d5 = dot(ab, cp);
+    const double d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        v = 0.0;
+        w = 1.0;
+        return;
+    }
+
+    const double vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        v = 0.0;
+        w = d2 / (d2 - d6);
+        return;
+    }
+
+    const double va = d3 * d6 - d5 * d4;
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        v = 1.0 - w;
+        return;
+    }
+
+    const double denominator = va + vb + vc;
+    if (denominator == 0.0) {
+        // Degenerate triangle whose corners all project inside: fall back to corner a
+        v = 0.0;
+        w = 0.0;
+        return;
+    }
+    v = vb / denominator;
+    w = vc / denominator;
+}
+
+// Two-sided ray/triangle intersection (Moeller-Trumbore)
+inline bool intersect_triangle(const double* origin, const double* direction, const double* a, const double* b,
+                               const double* c, double& t, double& u, double& v) {
+    double e1[3], e2[3], p[3];
+    sub(b, a, e1);
+    sub(c, a, e2);
+    cross(direction, e2, p);
+    const double determinant = dot(e1, p);
+    if (determinant == 0.0) {
+        return false;
+    }
+    const double inverse = 1.0 / determinant;
+
+    double s[3];
+    sub(origin, a, s);
+    u = dot(s, p) * inverse;
+    if (u < 0.0 || u > 1.0) {
+        return false;
+    }
+
+    double q[3];
+    cross(s, e1, q);
+    v = dot(direction, q) * inverse;
+    if (v < 0.0 || u + v > 1.0) {
+        return false;
+    }
+
+    t = dot(e2, q) * inverse;
+    return true;
+}
+
+// Signed distances of a triangle's corners to the outward oriented plane of triangle abc;
+// false if that triangle is degenerate. Distances within the tolerance are snapped to 0,
+// which counts as outside: as if both shapes were shrunk slightly, touching triangles do
+// not cross, and a crossing along a mesh edge is found on only one side of the edge.
+inline bool plane_distances(const double* const corners[3], const double* a, const double* b, const double* c,
+                            bool reversed, double tolerance, double normal[3], double distances[3]) {
+    double ab[3], ac[3];
+    sub(b, a, ab);
+    sub(c, a, ac);
+    cross(ab, ac, normal);
+    const double length = std::sqrt(dot(normal, normal));
+    if (length == 0.0) {
+        return false;
+    }
+    for (int k = 0; k < 3; k++) {
+        normal[k] /= reversed ? -length : length;
+    }
+    for (int i = 0; i < 3; i++) {
+        double offset[3];
+        sub(corners[i], a, offset);
+        distances[i] = dot(normal, offset);
+        if (std::abs(distances[i]) <= tolerance) {
+            distances[i] = 0.0;
+        }
+    }
+    return true;
+}
+
+// Segment where a triangle crosses a plane, from the signed distances of its corners;
+// false unless it has corners inside and outside
+inline bool plane_crossing(const double* const corners[3], const double distances[3], double segment[2][3]) {
+    int count = 0;
+    for (int i = 0; i < 3; i++) {
+        const int j = (i + 1) % 3;
+        if ((distances[i] < 0.0) != (distances[j] < 0.0)) {
+            const double ratio = distances[i] / (distances[i] - distances[j]);
+            for (int k = 0; k < 3; k++) {
+                segment[count][k] = corners[i][k] + ratio * (corners[j][k] - corners[i][k]);
+            }
+            count++;
+        }
+    }
+    return count == 2;
+}
+
+} // namespace
+
+void ocgd_TriangleBVH::clear() {
+    _faces.clear();
+    _positions.clear();
+    _triangles.clear();
+    _triangle_faces.clear();
+    _nodes.clear();
+}
+
+void ocgd_TriangleBVH::build(const TopoDS_Shape& shape, int worker_count) {
+    clear();
+
+    // Count nodes and triangles serially, then copy each face into its range in parallel
+    std::vector<int> first_triangles;
+    std::vector<TopLoc_Location> locations;
+    int node_count = 0;
+    int triangle_total = 0;
+    for (TopExp_Explorer face_explorer(shape, TopAbs_FACE); face_explorer.More(); face_explorer.Next()) {
+        FaceEntry entry;
+        entry.face = TopoDS::Face(face_explorer.Current());
+        entry.reversed = entry.face.Orientation() == TopAbs_REVERSED;
+        entry.first_node = node_count;
+
+        TopLoc_Location location;
+        entry.triangulation = BRep_Tool::Triangulation(entry.face, location);
+        first_triangles.push_back(triangle_total);
+        if (!entry.triangulation.IsNull()) {
+            node_count += entry.triangulation->NbNodes();
+            triangle_total += entry.triangulation->NbTriangles();
+        }
+        locations.push_back(location);
+        _faces.push_back(entry);
+    }
+
+    if (triangle_total == 0) {
+        return;
+    }
+
+    _positions.resize(static_cast<size_t>(node_count) * 3);
+    _triangles.resize(static_cast<size_t>(triangle_total) * 3);
+    _triangle_faces.resize(static_cast<size_t>(triangle_total));
+
+    ocgd_ParallelFor::run(face_count(), worker_count, [&](int face_index) {
+        const FaceEntry& entry = _faces[face_index];
+        if (entry.triangulation.IsNull()) {
+            return;
+        }
+
+        const Poly_Triangulation& triangulation = *entry.triangulation;
+        const bool transformed = !locations[face_index].IsIdentity();
+        const gp_Trsf transformation = locations[face_index].Transformation();
+        double* positions = &_positions[static_cast<size_t>(entry.first_node) * 3];
+        for (int i = 1; i <= triangulation.NbNodes(); i++) {
+            gp_Pnt node = triangulation.Node(i);
+            if (transformed) {
+                node.Transform(transformation);
+            }
+            *positions++ = node.X();
+            *positions++ = node.Y();
+            *positions++ = node.Z();
+        }
+
+        const int first_triangle = first_triangles[face_index];
+        int32_t* triangles = &_triangles[static_cast<size_t>(first_triangle) * 3];
+        for (int i = 1; i <= triangulation.NbTriangles(); i++) {
+            int n1, n2, n3;
+            triangulation.Triangle(i).Get(n1, n2, n3);
+            *triangles++ = entry.first_node + n1 - 1;
+            *triangles++ = entry.first_node + n2 - 1;
+            *triangles++ = entry.first_node + n3 - 1;
+            _triangle_faces[first_triangle + i - 1] = face_index;
+        }
+    });
+
+    build_hierarchy();
+}
+
+void ocgd_TriangleBVH::build_hierarchy() {
+    const int count = triangle_count();
+    std::vector<double> centroids(static_cast<size_t>(count) * 3);
+    std::vector<double> bounds(static_cast<size_t>(count) * 6);
+    for (int t = 0; t < count; t++) {
+        const double* a = position(_triangles[t * 3]);
+        const double* b = position(_triangles[t * 3 + 1]);
+        const double* c = position(_triangles[t * 3 + 2]);
+        for (int k = 0; k < 3; k++) {
+            centroids[t * 3 + k] = (a[k] + b[k] + c[k]) / 3.0;
+            bounds[t * 6 + k] = std::min(a[k], std::min(b[k], c[k]));
+            bounds[t * 6 + 3 + k] = std::max(a[k], std::max(b[k], c[k]));
+        }
+    }
+
+    std::vector<int32_t> order(static_cast<size_t>(count));
+    for (int t = 0; t < count; t++) {
+        order[t] = t;
+    }
+
+    // Median split along the longest centroid axis; nodes are laid out depth first,
+    // so the left child of an inner node always directly follows it
+    _nodes.reserve(static_cast<size_t>(count / MAX_LEAF_SIZE) * 2 + 1);
+    struct Builder {
+        ocgd_TriangleBVH& bvh;
+        const std::vector<double>& centroids;
+        const std::vector<double>& bounds;
+        std::vector<int32_t>& order;
+
+        void build(int begin, int end) {
+            const size_t node_index = bvh._nodes.size();
+            bvh._nodes.push_back(Node());
+
+            double centroid_min[3], centroid_max[3];
+            for (int k = 0; k < 3; k++) {
+                bvh._nodes[node_index].min[k] = std::numeric_limits<double>::infinity();
+                bvh._nodes[node_index].max[k] = -std::numeric_limits<double>::infinity();
+                centroid_min[k] = std::numeric_limits<double>::infinity();
+                centroid_max[k] = -std::numeric_limits<double>::infinity();
+            }
+            for (int i = begin; i < end; i++) {
+                const int32_t t = order[i];
+                Node& node = bvh._nodes[node_index];
+                for (int k = 0; k < 3; k++) {
+                    node.min[k] = std::min(node.min[k], bounds[t * 6 + k]);
+                    node.max[k] = std::max(node.max[k], bounds[t * 6 + 3 + k]);
+                    centroid_min[k] = std::min(centroid_min[k], centroids[t * 3 + k]);
+                    centroid_max[k] = std::max(centroid_max[k], centroids[t * 3 + k]);
+                }
+            }
+
+            int axis = 0;
+            for (int k = 1; k < 3; k++) {
+                if (centroid_max[k] - centroid_min[k] > centroid_max[axis] - centroid_min[axis]) {
+                    axis = k;
+                }
+            }
+
+            // Triangles with coincident centroids cannot be separated and stay in one leaf
+            if (end - begin <= MAX_LEAF_SIZE || !(centroid_max[axis] > centroid_min[axis])) {
+                bvh._nodes[node_index].first = begin;
+                bvh._nodes[node_index].count = end - begin;
+                return;
+            }
+
+            const int middle = begin + (end - begin) / 2;
+            const double* centroid_data = centroids.data();
+            std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+                             [centroid_data, axis](int32_t a, int32_t b) {
+                                 return centroid_data[a * 3 + axis] < centroid_data[b * 3 + axis];
+                             });
+
+            build(begin, middle);
+            bvh._nodes[node_index].first = static_cast<int32_t>(bvh._nodes.size());
+            bvh._nodes[node_index].count = 0;
+            build(middle, end);
+        }
+    };
+    Builder builder{*this, centroids, bounds, order};
+    builder.build(0, count);
+
+    // Store triangles in leaf order so each leaf reads one contiguous range
+    std::vector<int32_t> triangles(_triangles.size());
+    std::vector<int32_t> triangle_faces(_triangle_faces.size());
+    for (int i = 0; i < count; i++) {
+        const int32_t t = order[i];
+        triangles[i * 3] = _triangles[t * 3];
+        triangles[i * 3 + 1] = _triangles[t * 3 + 1];
+        triangles[i * 3 + 2] = _triangles[t * 3 + 2];
+        triangle_faces[i] = _triangle_faces[t];
+    }
+    _triangles.swap(triangles);
+    _triangle_faces.swap(triangle_faces);
+}
+
+gp_Pnt ocgd_TriangleBVH::node_point(int node) const {
+    const double* p = position(node);
+    return gp_Pnt(p[0], p[1], p[2]);
+}
+
+gp_Pnt ocgd_TriangleBVH::triangle_node(int triangle, int corner) const {
+    const double* p = position(_triangles[triangle * 3 + corner]);
+    return gp_Pnt(p[0], p[1], p[2]);
+}
+
+gp_Vec ocgd_TriangleBVH::triangle_normal(int triangle) const {
+    const double* a = position(_triangles[triangle * 3]);
+    const double* b = position(_triangles[triangle * 3 + 1]);
+    const double* c = position(_triangles[triangle * 3 + 2]);
+    double ab[3], ac[3], n[3];
+    sub(b, a, ab);
+    sub(c, a, ac);
+    cross(ab, ac, n);
+    const gp_Vec normal(n[0], n[1], n[2]);
+    return _faces[_triangle_faces[triangle]].reversed ? normal.Reversed() : normal;
+}
+
+bool ocgd_TriangleBVH::triangle_uv(int triangle, double u, double v, gp_Pnt2d& uv) const {
+    const FaceEntry& entry = _faces[_triangle_faces[triangle]];
+    if (entry.triangulation.IsNull() || !entry.triangulation->HasUVNodes()) {
+        return false;
+    }
+
+    const gp_Pnt2d a = entry.triangulation->UVNode(_triangles[triangle * 3] - entry.first_node + 1);
+    const gp_Pnt2d b = entry.triangulation->UVNode(_triangles[triangle * 3 + 1] - entry.first_node + 1);
+    const gp_Pnt2d c = entry.triangulation->UVNode(_triangles[triangle * 3 + 2] - entry.first_node + 1);
+    uv.SetCoord(a.X() + u * (b.X() - a.X()) + v * (c.X() - a.X()),
+                a.Y() + u * (b.Y() - a.Y()) + v * (c.Y() - a.Y()));
+    return true;
+}
+
+double ocgd_TriangleBVH::triangle_size(int triangle) const {
+    const double* a = position(_triangles[triangle * 3]);
+    const double* b = position(_triangles[triangle * 3 + 1]);
+    const double* c = position(_triangles[triangle * 3 + 2]);
+    double ab[3], bc[3], ca[3];
+    sub(b, a, ab);
+    sub(c, b, bc);
+    sub(a, c, ca);
+    return std::sqrt(std::max(dot(ab, ab), std::max(dot(bc, bc), dot(ca, ca))));
+}
+
+bool ocgd_TriangleBVH::closest_point(const gp_Pnt& point, double max_distance, TrianglePoint& result) const {
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    const double p[3] = {point.X(), point.Y(), point.Z()};
+    double best = max_distance > 0.0 ? max_distance * max_distance : std::numeric_limits<double>::infinity();
+    int best_triangle = -1;
+    double best_v = 0.0;
+    double best_w = 0.0;
+
+    struct Entry {
+        int32_t node;
+        double distance;
+    };
+    Entry stack[MAX_STACK_DEPTH];
+    int depth = 0;
+    stack[depth++] = {0, box_distance_squared(_nodes[0].min, _nodes[0].max, p)};
+
+    while (depth > 0) {
+        const Entry entry = stack[--depth];
+        if (entry.distance > best) {
+            continue;
+        }
+
+        const Node& node = _nodes[entry.node];
+        if (node.count > 0) {
+            for (int t = node.first; t < node.first + node.count; t++) {
+                const double* a = position(_triangles[t * 3]);
+                const double* b = position(_triangles[t * 3 + 1]);
+                const double* c = position(_triangles[t * 3 + 2]);
+                double v, w;
+                closest_on_triangle(p, a, b, c, v, w);
+                double d[3];
+                for (int k = 0; k < 3; k++) {
+                    d[k] = a[k] + v * (b[k] - a[k]) + w * (c[k] - a[k]) - p[k];
+                }
+                const double distance = dot(d, d);
+                if (distance < best || (best_triangle < 0 && distance <= best)) {
+                    best = distance;
+                    best_triangle = t;
+                    best_v = v;
+                    best_w = w;
+                }
+            }
+            continue;
+        }
+
+        // Visit the nearer child first by pushing it last
+        const int32_t left = entry.node + 1;
+        const int32_t right = node.first;
+        const double left_distance = box_distance_squared(_nodes[left].min, _nodes[left].max, p);
+        const double right_distance = box_distance_squared(_nodes[right].min, _nodes[right].max, p);
+        const bool left_first = left_distance <= right_distance;
+        const Entry near_entry = left_first ? Entry{left, left_distance} : Entry{right, right_distance};
+        const Entry far_entry = left_first ? Entry{right, right_distance} : Entry{left, left_distance};
+        if (far_entry.distance <= best && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = far_entry;
+        }
+        if (near_entry.distance <= best && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = near_entry;
+        }
+    }
+
+    if (best_triangle < 0) {
+        return false;
+    }
+
+    const double* a = position(_triangles[best_triangle * 3]);
+    const double* b = position(_triangles[best_triangle * 3 + 1]);
+    const double* c = position(_triangles[best_triangle * 3 + 2]);
+    result.point.SetCoord(a[0] + best_v * (b[0] - a[0]) + best_w * (c[0] - a[0]),
+                          a[1] + best_v * (b[1] - a[1]) + best_w * (c[1] - a[1]),
+                          a[2] + best_v * (b[2] - a[2]) + best_w * (c[2] - a[2]));
+    result.distance = std::sqrt(best);
+    result.triangle = best_triangle;
+    result.u = best_v;
+    result.v = best_w;
+    return true;
+}
+
+bool ocgd_TriangleBVH::intersect_ray(const gp_Pnt& origin, const gp_Vec& direction, double min_distance,
+                                     double max_distance, TrianglePoint& result) const {
+    if (_nodes.empty()) {
+        return false;
+    }
+
+    const double o[3] = {origin.X(), origin.Y(), origin.Z()};
+    const double d[3] = {direction.X(), direction.Y(), direction.Z()};
+    const double inverse_direction[3] = {1.0 / d[0], 1.0 / d[1], 1.0 / d[2]};
+    const double t_min = std::max(min_distance, 0.0);
+    double best = max_distance > 0.0 ? max_distance : std::numeric_limits<double>::infinity();
+    int best_triangle = -1;
+    double best_u = 0.0;
+    double best_v = 0.0;
+
+    struct Entry {
+        int32_t node;
+        double entry;
+    };
+    Entry stack[MAX_STACK_DEPTH];
+    int depth = 0;
+    const double root_entry = box_ray_entry(_nodes[0].min, _nodes[0].max, o, inverse_direction, t_min, best);
+    if (!std::isinf(root_entry)) {
+        stack[depth++] = {0, root_entry};
+    }
+
+    while (depth > 0) {
+        const Entry entry = stack[--depth];
+        if (entry.entry > best) {
+            continue;
+        }
+
+        const Node& node = _nodes[entry.node];
+        if (node.count > 0) {
+            for (int t = node.first; t < node.first + node.count; t++) {
+                double hit, u, v;
+                if (intersect_triangle(o, d, position(_triangles[t * 3]), position(_triangles[t * 3 + 1]),
+                                       position(_triangles[t * 3 + 2]), hit, u, v)
+                    && hit >= t_min && hit <= best) {
+                    best = hit;
+                    best_triangle = t;
+                    best_u = u;
+                    best_v = v;
+                }
+            }
+            continue;
+        }
+
+        const int32_t left = entry.node + 1;
+        const int32_t right = node.first;
+        const double left_entry = box_ray_entry(_nodes[left].min, _nodes[left].max, o, inverse_direction, t_min, best);
+        const double right_entry = box_ray_entry(_nodes[right].min, _nodes[right].max, o, inverse_direction, t_min, best);
+        const bool left_first = left_entry <= right_entry;
+        const Entry near_entry = left_first ? Entry{left, left_entry} : Entry{right, right_entry};
+        const Entry far_entry = left_first ? Entry{right, right_entry} : Entry{left, left_entry};
+        if (!std::isinf(far_entry.entry) && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = far_entry;
+        }
+        if (!std::isinf(near_entry.entry) && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = near_entry;
+        }
+    }
+
+    if (best_triangle < 0) {
+        return false;
+    }
+
+    result.point.SetCoord(o[0] + best * d[0], o[1] + best * d[1], o[2] + best * d[2]);
+    result.distance = best;
+    result.triangle = best_triangle;
+    result.u = best_u;
+    result.v = best_v;
+    return true;
+}
+
+int ocgd_TriangleBVH::ray_crossings(const gp_Pnt& origin, const gp_Vec& direction, double edge_tolerance,
+                                   bool& ambiguous) const {
+    ambiguous = false;
+    if (_nodes.empty()) {
+        return 0;
+    }
+
+    const double o[3] = {origin.X(), origin.Y(), origin.Z()};
+    const double d[3] = {direction.X(), direction.Y(), direction.Z()};
+    const double inverse_direction[3] = {1.0 / d[0], 1.0 / d[1], 1.0 / d[2]};
+    const double infinity = std::numeric_limits<double>::infinity();
+    int crossings = 0;
+
+    int32_t stack[MAX_STACK_DEPTH];
+    int depth = 0;
+    if (!std::isinf(box_ray_entry(_nodes[0].min, _nodes[0].max, o, inverse_direction, 0.0, infinity))) {
+        stack[depth++] = 0;
+    }
+
+    while (depth > 0) {
+        const int32_t node_index = stack[--depth];
+        const Node& node = _nodes[node_index];
+        if (node.count > 0) {
+            for (int t = node.first; t < node.first + node.count; t++) {
+                const double* a = position(_triangles[t * 3]);
+                const double* b = position(_triangles[t * 3 + 1]);
+                const double* c = position(_triangles[t * 3 + 2]);
+                double e1[3], e2[3], p[3];
+                sub(b, a, e1);
+                sub(c, a, e2);
+                cross(d, e2, p);
+                const double determinant = dot(e1, p);
+
+                // Rays (nearly) in the plane of a triangle may slip between it and its neighbours
+                double normal[3];
+                cross(e1, e2, normal);
+                const double normal_length = std::sqrt(dot(normal, normal));
+                if (std::abs(determinant) <= edge_tolerance * normal_length) {
+                    if (normal_length > 0.0) {
+                        double u, v, hit;
+                        if (intersect_triangle(o, d, a, b, c, hit, u, v) && hit >= 0.0) {
+                            ambiguous = true;
+                        }
+                    }
+                    continue;
+                }
+
+                const double inverse = 1.0 / determinant;
+                double s[3], q[3];
+                sub(o, a, s);
+                const double u = dot(s, p) * inverse;
+                cross(s, e1, q);
+                const double v = dot(d, q) * inverse;
+                const double w = 1.0 - u - v;
+                if (u < -edge_tolerance || v < -edge_tolerance || w < -edge_tolerance) {
+                    continue;
+                }
+                if (dot(e2, q) * inverse < 0.0) {
+                    continue;
+                }
+                if (u <= edge_tolerance || v <= edge_tolerance || w <= edge_tolerance) {
+                    ambiguous = true;
+                }
+                crossings++;
+            }
+            continue;
+        }
+
+        const int32_t children[2] = {node_index + 1, node.first};
+        for (int32_t child : children) {
+            if (depth < MAX_STACK_DEPTH
+                && !std::isinf(box_ray_entry(_nodes[child].min, _nodes[child].max, o, inverse_direction, 0.0, infinity))) {
+                stack[depth++] = child;
+            }
+        }
+    }
+
+    return crossings;
+}
+
+void ocgd_TriangleBVH::bounds(gp_Pnt& min, gp_Pnt& max) const {
+    min.SetCoord(_nodes[0].min[0], _nodes[0].min[1], _nodes[0].min[2]);
+    max.SetCoord(_nodes[0].max[0], _nodes[0].max[1], _nodes[0].max[2]);
+}
+
+void ocgd_TriangleBVH::triangles_in_box(const gp_Pnt& min, const gp_Pnt& max, std::vector<int>& triangles) const {
+    if (_nodes.empty()) {
+        return;
+    }
+
+    const double box_min[3] = {min.X(), min.Y(), min.Z()};
+    const double box_max[3] = {max.X(), max.Y(), max.Z()};
+    const auto overlaps = [&](const double* node_min, const double* node_max) {
+        for (int k = 0; k < 3; k++) {
+            if (node_min[k] > box_max[k] || node_max[k] < box_min[k]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    int32_t stack[MAX_STACK_DEPTH];
+    int depth = 0;
+    if (overlaps(_nodes[0].min, _nodes[0].max)) {
+        stack[depth++] = 0;
+    }
+
+    while (depth > 0) {
+        const int32_t index = stack[--depth];
+        const Node& node = _nodes[index];
+        if (node.count > 0) {
+            for (int t = node.first; t < node.first + node.count; t++) {
+                const double* a = position(_triangles[t * 3]);
+                const double* b = position(_triangles[t * 3 + 1]);
+                const double* c = position(_triangles[t * 3 + 2]);
+                double triangle_min[3], triangle_max[3];
+                for (int k = 0; k < 3; k++) {
+                    triangle_min[k] = std::min(a[k], std::min(b[k], c[k]));
+                    triangle_max[k] = std::max(a[k], std::max(b[k], c[k]));
+                }
+                if (overlaps(triangle_min, triangle_max)) {
+                    triangles.push_back(t);
+                }
+            }
+            continue;
+        }
+
+        const int32_t left = index + 1;
+        const int32_t right = node.first;
+        if (overlaps(_nodes[right].min, _nodes[right].max) && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = right;
+        }
+        if (overlaps(_nodes[left].min, _nodes[left].max) && depth < MAX_STACK_DEPTH) {
+            stack[depth++] = left;
+        }
+    }
+}
+
+bool ocgd_TriangleBVH::intersect_triangle_pair(int triangle, const ocgd_TriangleBVH& other, int other_triangle,
+                                               double tolerance, gp_Pnt& start, gp_Pnt& end) const {
+    // Moeller's interval overlap test: each triangle meets the other's plane along a segment,
+    // and both segments lie on the planes' common line
+    const double* const first[3] = {position(_triangles[triangle * 3]), position(_triangles[triangle * 3 + 1]),
+                                    position(_triangles[triangle * 3 + 2])};
+    const double* const second[3] = {other.position(other._triangles[other_triangle * 3]),
+                                     other.position(other._triangles[other_triangle * 3 + 1]),
+                                     other.position(other._triangles[other_triangle * 3 + 2])};
+
+    double first_normal[3], second_normal[3];
+    double first_distances[3], second_distances[3];
+    if (!plane_distances(first, second[0], second[1], second[2], other._faces[other._triangle_faces[other_triangle]].reversed,
+                         tolerance, second_normal, first_distances)
+        || !plane_distances(second, first[0], first[1], first[2], _faces[_triangle_faces[triangle]].reversed, tolerance,
+                            first_normal, second_distances)) {
+        return false;
+    }
+
+    // Both triangles must cross the other's plane
+    double first_segment[2][3], second_segment[2][3];
+    if (!plane_crossing(first, first_distances, first_segment) || !plane_crossing(second, second_distances, second_segment)) {
+        return false;
+    }
+
+    double line[3];
+    cross(first_normal, second_normal, line);
+    double first_range[2] = {dot(line, first_segment[0]), dot(line, first_segment[1])};
+    double second_range[2] = {dot(line, second_segment[0]), dot(line, second_segment[1])};
+    if (first_range[0] > first_range[1]) {
+        std::swap(first_range[0], first_range[1]);
+        std::swap(first_segment[0], first_segment[1]);
+    }
+    if (second_range[0] > second_range[1]) {
+        std::swap(second_range[0], second_range[1]);
+        std::swap(second_segment[0], second_segment[1]);
+    }
+    if (std::min(first_range[1], second_range[1]) <= std::max(first_range[0], second_range[0])) {
+        return false;
+    }
+
+    const double* low = first_range[0] >= second_range[0] ? first_segment[0] : second_segment[0];
+    const double* high = first_range[1] <= second_range[1] ? first_segment[1] : second_segment[1];
+    start.SetCoord(low[0], low[1], low[2]);
+    end.SetCoord(high[0], high[1], high[2]);
+    return true;
+}
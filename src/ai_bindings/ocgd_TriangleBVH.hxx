@@ -0,0 +1,159 @@
+/**
+ * ocgd_TriangleBVH.hxx
+ *
+ * Internal helper holding the triangulation of a shape in a bounding volume hierarchy,
+ * so that closest-point and ray queries cost a logarithmic number of triangle tests
+ * instead of a full BRepExtrema run per query.
+ *
+ * The hierarchy is immutable once built, so any number of threads may query it at once.
+ *
+ * This file is part of OpenCASCADE.gd bindings.
+ */
+
+#ifndef _ocgd_TriangleBVH_HeaderFile
+#define _ocgd_TriangleBVH_HeaderFile
+
+#include <opencascade/Poly_Triangulation.hxx>
+#include <opencascade/TopoDS_Face.hxx>
+#include <opencascade/TopoDS_Shape.hxx>
+#include <opencascade/gp_Pnt.hxx>
+#include <opencascade/gp_Pnt2d.hxx>
+#include <opencascade/gp_Vec.hxx>
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Triangle BVH over all face triangulations of a shape.
+ *
+ * Faces are numbered in TopExp_Explorer order, like the face indices of
+ * ocgd_MeshDataExtractor. Faces without a triangulation are numbered but hold no triangles.
+ */
+class ocgd_TriangleBVH {
+public:
+    //! Face whose triangles are stored in the hierarchy
+    struct FaceEntry {
+        TopoDS_Face face;
+        Handle(Poly_Triangulation) triangulation;
+        int first_node = 0;     ///< Index of the face's first node in the node array
+        bool reversed = false;  ///< Face orientation is reversed, so triangle normals are flipped
+    };
+
+    //! Point on a triangle; the point is a + u * (b - a) + v * (c - a) for triangle nodes a, b, c
+    struct TrianglePoint {
+        gp_Pnt point;
+        double distance = -1.0;
+        int triangle = -1;
+        double u = 0.0;
+        double v = 0.0;
+    };
+
+    /**
+     * @brief Collect the triangulation of every face of a shape and build the hierarchy.
+     * The shape must already be meshed.
+     * @param worker_count Number of workers used to gather nodes, 0 or less uses one per core
+     */
+    void build(const TopoDS_Shape& shape, int worker_count);
+
+    //! Drop all triangles and faces
+    void clear();
+
+    bool is_empty() const { return _nodes.empty(); }
+    int triangle_count() const { return static_cast<int>(_triangle_faces.size()); }
+    int face_count() const { return static_cast<int>(_faces.size()); }
+
+    //! Number of triangulation nodes; faces do not share nodes
+    int node_count() const { return static_cast<int>(_positions.size() / 3); }
+
+    //! World position of a triangulation node
+    gp_Pnt node_point(int node) const;
+
+    //! Face index of a triangle
+    int triangle_face(int triangle) const { return _triangle_faces[triangle]; }
+
+    //! Triangulation node of a triangle corner (0, 1 or 2), numbered from the face's first_node
+    int triangle_node_index(int triangle, int corner) const { return _triangles[static_cast<size_t>(triangle) * 3 + corner]; }
+
+    const FaceEntry& face(int face_index) const { return _faces[face_index]; }
+
+    //! World position of a triangle corner (0, 1 or 2)
+    gp_Pnt triangle_node(int triangle, int corner) const;
+
+    //! Unnormalized triangle normal, oriented like the outward normal of its face
+    gp_Vec triangle_normal(int triangle) const;
+
+    //! Interpolated surface parameters at a point of a triangle; false if the face
+    //! triangulation has no UV nodes
+    bool triangle_uv(int triangle, double u, double v, gp_Pnt2d& uv) const;
+
+    //! Longest edge of a triangle
+    double triangle_size(int triangle) const;
+
+    //! Bounding box of all triangles; must not be empty
+    void bounds(gp_Pnt& min, gp_Pnt& max) const;
+
+    /**
+     * @brief Find the closest point to a query point on any triangle.
+     * @param max_distance Only points closer than this are found; 0 or less is unlimited
+     * @return false if no triangle is within max_distance
+     */
+    bool closest_point(const gp_Pnt& point, double max_distance, TrianglePoint& result) const;
+
+    /**
+     * @brief Find the first triangle hit by a ray. Triangles are hit from both sides.
+     * @param direction Ray direction, must be normalized
+     * @param min_distance Hits closer to the origin are ignored, e.g. to leave a surface
+     * @param max_distance Hits farther than this are ignored; 0 or less is unlimited
+     * @return false if nothing was hit
+     */
+    bool intersect_ray(const gp_Pnt& origin, const gp_Vec& direction, double min_distance, double max_distance,
+                       TrianglePoint& result) const;
+
+    /**
+     * @brief Count the triangles crossed by a ray, for inside/outside parity tests.
+     * @param direction Ray direction, must be normalized
+     * @param edge_tolerance Relative (barycentric) distance to triangle edges below which a
+     *        crossing is ambiguous, as the ray may be counted on both or neither neighbour
+     * @param ambiguous Set if any crossing is near an edge or grazes its triangle
+     */
+    int ray_crossings(const gp_Pnt& origin, const gp_Vec& direction, double edge_tolerance, bool& ambiguous) const;
+
+    /**
+     * @brief Collect the triangles whose bounding boxes overlap a box.
+     * @param triangles Receives the triangle indices; existing entries are kept
+     */
+    void triangles_in_box(const gp_Pnt& min, const gp_Pnt& max, std::vector<int>& triangles) const;
+
+    /**
+     * @brief Intersect a triangle with a triangle of another hierarchy.
+     * Triangle normals are taken as outward, and corners within the tolerance of the other
+     * triangle's plane count as outside, so triangles of shapes that merely touch do not
+     * intersect and crossings along mesh edges are found once.
+     * @param start, end Receive the intersection segment
+     * @return false if the triangles do not cross
+     */
+    bool intersect_triangle_pair(int triangle, const ocgd_TriangleBVH& other, int other_triangle, double tolerance,
+                                 gp_Pnt& start, gp_Pnt& end) const;
+
+private:
+    //! Inner nodes have count 0 and their children at index + 1 and first;
+    //! leaves hold count triangles starting at first
+    struct Node {
+        double min[3];
+        double max[3];
+        int32_t first;
+        int32_t count;
+    };
+
+    std::vector<FaceEntry> _faces;
+    std::vector<double> _positions;        ///< x, y, z per node, in world coordinates
+    std::vector<int32_t> _triangles;       ///< Three node indices per triangle, in leaf order
+    std::vector<int32_t> _triangle_faces;  ///< Face index per triangle
+    std::vector<Node> _nodes;
+
+    const double* position(int32_t node) const { return &_positions[static_cast<size_t>(node) * 3]; }
+
+    void build_hierarchy();
+};
+
+#endif // _ocgd_TriangleBVH_HeaderFile
@@ -24,7 +24,11 @@
 #include "ocgd_AdvancedMeshExporter.hxx"
 #include "ocgd_TopologyAnalyzer.hxx"
 #include "ocgd_CADFileImporter.hxx"
+#include "ocgd_CADImportJob.hxx"
 #include "ocgd_SurfaceUtils.hxx"
+#include "ocgd_TessellationCache.hxx"
+#include "ocgd_ArrayMeshBuilder.hxx"
+#include "ocgd_SpatialQuery.hxx"
 
 using namespace godot;
 
@@ -47,7 +51,11 @@ void ocgd_initialize_module(ModuleInitializationLevel p_level) {
     GDREGISTER_CLASS(ocgd_AdvancedMeshExporter);
     GDREGISTER_CLASS(ocgd_TopologyAnalyzer);
     GDREGISTER_CLASS(ocgd_CADFileImporter);
+    GDREGISTER_CLASS(ocgd_CADImportJob);
     GDREGISTER_CLASS(ocgd_SurfaceUtils);
+    GDREGISTER_CLASS(ocgd_TessellationCache);
+    GDREGISTER_CLASS(ocgd_ArrayMeshBuilder);
+    GDREGISTER_CLASS(ocgd_SpatialQuery);
 }
 
 void ocgd_uninitialize_module(ModuleInitializationLevel p_level) {
@@ -11,38 +11,54 @@
 #include <godot_cpp/variant/dictionary.hpp>
 #include <TopoDS.hxx>
 #include <godot_cpp/core/class_db.hpp>
+#include "../ai_bindings/ocgd_ParallelFor.hxx"
+#include "../ai_bindings/ocgd_MeshDataExtractor.hxx"
 
-godot::TypedArray<godot::Dictionary> OCCMeshExtractor::extract_mesh(const godot::Ref<OCCShape> &shape, double deflection) {
+#include <vector>
+
+godot::TypedArray<godot::Dictionary> OCCMeshExtractor::extract_mesh(const godot::Ref<OCCShape> &shape, double deflection, int worker_count) {
     godot::TypedArray<godot::Dictionary> mesh_arrays;
     if (shape.is_null() || shape->is_null())
         return mesh_arrays;
 
     BRepMesh_IncrementalMesh(shape->get_occ_shape(), deflection);
 
+    // Faces are independent once meshed: convert them concurrently into per-face slots
+    std::vector<TopoDS_Face> faces;
     TopExp_Explorer exp;
     for (exp.Init(shape->get_occ_shape(), TopAbs_FACE); exp.More(); exp.Next()) {
-        TopoDS_Face face = TopoDS::Face(exp.Current());
+        faces.push_back(TopoDS::Face(exp.Current()));
+    }
+
+    std::vector<godot::Dictionary> face_dicts(faces.size());
+    std::vector<char> face_valid(faces.size(), 0);
+    ocgd_ParallelFor::run(static_cast<int>(faces.size()), worker_count, [&](int face_index) {
+        const TopoDS_Face& face = faces[face_index];
         TopLoc_Location location;
         Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, location);
-        if (triangulation.IsNull()) continue;
+        if (triangulation.IsNull()) return;
 
         Standard_Integer nNodes = triangulation->NbNodes();
         godot::PackedVector3Array godot_vertices;
+        godot_vertices.resize(nNodes);
+        godot::Vector3* vertex_ptr = godot_vertices.ptrw();
         for (Standard_Integer i = 1; i <= nNodes; ++i) {
             gp_Pnt p = triangulation->Node(i);
-            godot_vertices.push_back({(float)p.X(), (float)p.Y(), (float)p.Z()});
+            vertex_ptr[i - 1] = {(float)p.X(), (float)p.Y(), (float)p.Z()};
         }
 
         Standard_Integer nTriangles = triangulation->NbTriangles();
         godot::PackedInt32Array godot_indices;
+        godot_indices.resize(nTriangles * 3);
+        int32_t* index_ptr = godot_indices.ptrw();
         for (Standard_Integer i = 1; i <= nTriangles; ++i) {
             Poly_Triangle tri = triangulation->Triangle(i);
             Standard_Integer n1, n2, n3;
             tri.Get(n1, n2, n3);
             // Convert to zero-based indexing for Godot:
-            godot_indices.push_back(n1 - 1);
-            godot_indices.push_back(n2 - 1);
-            godot_indices.push_back(n3 - 1);
+            index_ptr[(i - 1) * 3 + 0] = n1 - 1;
+            index_ptr[(i - 1) * 3 + 1] = n2 - 1;
+            index_ptr[(i - 1) * 3 + 2] = n3 - 1;
         }
 
         godot::Dictionary face_dict;
@@ -50,17 +66,53 @@ godot::TypedArray<godot::Dictionary> OCCMeshExtractor::extract_mesh(const godot:
         face_dict["indices"] = godot_indices;
         if (triangulation->HasNormals()) {
             godot::PackedVector3Array godot_normals;
+            godot_normals.resize(nNodes);
+            godot::Vector3* normal_ptr = godot_normals.ptrw();
             for (Standard_Integer i = 1; i <= nNodes; ++i) {
                 gp_Dir normal = triangulation->Normal(i);
-                godot_normals.push_back({(float)normal.X(), (float)normal.Y(), (float)normal.Z()});
+                normal_ptr[i - 1] = {(float)normal.X(), (float)normal.Y(), (float)normal.Z()};
             }
             face_dict["normals"] = godot_normals;
         }
-        mesh_arrays.push_back(face_dict);
+        face_dicts[face_index] = face_dict;
+        face_valid[face_index] = 1;
+    });
+
+    // Append in face order so the result matches the serial extraction
+    for (size_t i = 0; i < face_dicts.size(); ++i) {
+        if (face_valid[i])
+            mesh_arrays.push_back(face_dicts[i]);
     }
     return mesh_arrays;
 }
 
+godot::Dictionary OCCMeshExtractor::extract_merged_mesh(const godot::Ref<OCCShape> &shape, double deflection, int worker_count) {
+    godot::Dictionary mesh;
+    if (shape.is_null() || shape->is_null())
+        return mesh;
+
+    BRepMesh_IncrementalMesh(shape->get_occ_shape(), deflection);
+
+    // One group for all faces: a single draw call instead of one surface per face
+    godot::Ref<ocgd_MeshDataExtractor> extractor;
+    extractor.instantiate();
+    extractor->set_merge_vertices(false);
+    extractor->set_parallel_extraction(worker_count != 1);
+    extractor->set_worker_count(worker_count);
+
+    std::vector<ocgd_MeshDataExtractor::SurfaceArrays> groups(1);
+    extractor->extract_grouped_arrays(shape->get_occ_shape(), ocgd_MeshDataExtractor::MESH_PURPOSE_NONE, std::vector<int>(), groups);
+    if (groups[0].triangles.is_empty())
+        return mesh;
+
+    mesh["vertices"] = groups[0].vertices;
+    mesh["indices"] = groups[0].triangles;
+    mesh["normals"] = groups[0].normals;
+    mesh["face_ranges"] = groups[0].face_ranges;
+    return mesh;
+}
+
 void OCCMeshExtractor::_bind_methods() {
-    godot::ClassDB::bind_static_method("OCCMeshExtractor", godot::D_METHOD("extract_mesh", "shape", "deflection"), &OCCMeshExtractor::extract_mesh, 0.01);
+    godot::ClassDB::bind_static_method("OCCMeshExtractor", godot::D_METHOD("extract_mesh", "shape", "deflection", "worker_count"), &OCCMeshExtractor::extract_mesh, 0.01, 1);
+    godot::ClassDB::bind_static_method("OCCMeshExtractor", godot::D_METHOD("extract_merged_mesh", "shape", "deflection", "worker_count"), &OCCMeshExtractor::extract_merged_mesh, 0.01, 1);
 }
@@ -10,7 +10,12 @@ class OCCMeshExtractor : public godot::RefCounted {
 
 public:
     // Extract mesh: returns array of dictionaries {vertices, indices}
-    static godot::TypedArray<godot::Dictionary> extract_mesh(const godot::Ref<OCCShape> &shape, double deflection = 0.01);
+    // worker_count > 1 converts faces on that many threads, 1 (default) runs serially, 0 uses one thread per core
+    static godot::TypedArray<godot::Dictionary> extract_mesh(const godot::Ref<OCCShape> &shape, double deflection = 0.01, int worker_count = 1);
+
+    // Extract merged mesh: all faces in one dictionary {vertices, indices, normals, face_ranges}
+    // face_ranges holds (face index, first triangle, triangle count) per face for picking
+    static godot::Dictionary extract_merged_mesh(const godot::Ref<OCCShape> &shape, double deflection = 0.01, int worker_count = 1);
 
 protected:
     static void _bind_methods();
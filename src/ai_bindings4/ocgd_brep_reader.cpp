@@ -1,5 +1,6 @@
 #include "ocgd_brep_reader.h"
 #include "ocgd_shape.h"
+#include "../ai_bindings/ocgd_MemoryStream.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
@@ -24,7 +25,6 @@
 #include <Standard_Failure.hxx>
 #include <chrono>
 #include <fstream>
-#include <sstream>
 
 using namespace godot;
 
@@ -51,6 +51,7 @@ void ocgd_brep_reader::_bind_methods() {
     ClassDB::bind_method(D_METHOD("load_file", "file_path"), &ocgd_brep_reader::load_file);
     ClassDB::bind_method(D_METHOD("load_file_with_options", "file_path", "options"), &ocgd_brep_reader::load_file_with_options);
     ClassDB::bind_method(D_METHOD("load_from_string", "brep_content"), &ocgd_brep_reader::load_from_string);
+    ClassDB::bind_method(D_METHOD("load_from_bytes", "brep_data"), &ocgd_brep_reader::load_from_bytes);
     ClassDB::bind_method(D_METHOD("get_file_info"), &ocgd_brep_reader::get_file_info);
     ClassDB::bind_method(D_METHOD("get_all_shapes"), &ocgd_brep_reader::get_all_shapes);
     
@@ -202,10 +203,22 @@ Ref<ocgd_shape> ocgd_brep_reader::load_file_with_options(const String& file_path
 Ref<ocgd_shape> ocgd_brep_reader::load_from_string(const String& brep_content) {
     clear_error();
     ERR_FAIL_COND_V_MSG(brep_content.is_empty(), Ref<ocgd_shape>(), "BREP content is empty");
-    
+
+    CharString content_utf8 = brep_content.utf8();
+    return load_from_memory(content_utf8.get_data(), static_cast<size_t>(content_utf8.length()));
+}
+
+Ref<ocgd_shape> ocgd_brep_reader::load_from_bytes(const PackedByteArray& brep_data) {
+    clear_error();
+    ERR_FAIL_COND_V_MSG(brep_data.is_empty(), Ref<ocgd_shape>(), "BREP data is empty");
+
+    return load_from_memory(reinterpret_cast<const char*>(brep_data.ptr()), static_cast<size_t>(brep_data.size()));
+}
+
+Ref<ocgd_shape> ocgd_brep_reader::load_from_memory(const char* data, size_t size) {
     try {
-        CharString content_utf8 = brep_content.utf8();
-        std::istringstream stream(content_utf8.get_data());
+        // Parse straight from the caller's buffer instead of copying it into a stringstream
+        ocgd_MemoryIStream stream(data, size);
         
         TopoDS_Shape loaded_shape;
         BRep_Builder builder;
@@ -336,7 +349,7 @@ bool ocgd_brep_reader::validate_string(const String& brep_content) {
     
     try {
         CharString content_utf8 = brep_content.utf8();
-        std::istringstream stream(content_utf8.get_data());
+        ocgd_MemoryIStream stream(content_utf8.get_data(), static_cast<size_t>(content_utf8.length()));
         
         TopoDS_Shape test_shape;
         BRep_Builder builder;
@@ -5,6 +5,7 @@
 #include <godot_cpp/variant/string.hpp>
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
 #include <godot_cpp/classes/ref.hpp>
 
 // Forward declarations for OpenCASCADE
@@ -28,6 +29,9 @@ private:
     int memory_used;
     int shapes_loaded;
 
+    // Shared parser for in-memory BREP text; the buffer is read in place
+    godot::Ref<ocgd_shape> load_from_memory(const char* data, size_t size);
+
 protected:
     static void _bind_methods();
 
@@ -46,6 +50,9 @@ public:
     
     // Load from string content
     godot::Ref<ocgd_shape> load_from_string(const godot::String& brep_content);
+
+    // Load from raw BREP bytes (e.g. FileAccess.get_file_as_bytes) without copying them
+    godot::Ref<ocgd_shape> load_from_bytes(const godot::PackedByteArray& brep_data);
     
     // Get detailed information about the loaded file
     godot::Dictionary get_file_info() const;
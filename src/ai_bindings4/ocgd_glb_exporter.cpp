@@ -1,9 +1,13 @@
 #include "ocgd_glb_exporter.h"
+#include "ocgd_glb_quantizer.h"
+#include "ocgd_memory_file_system.h"
 #include "ocgd_shape.h"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/transform3d.hpp>
+#include <godot_cpp/classes/file_access.hpp>
 
 // OpenCASCADE includes
 #include <TopoDS_Shape.hxx>
@@ -12,6 +16,12 @@
 #include <TopAbs_ShapeEnum.hxx>
 #include <BRep_Tool.hxx>
 #include <BRepMesh_IncrementalMesh.hxx>
+#include <BRepTools.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_MapOfShape.hxx>
+#include <TopTools_OrientedShapeMapHasher.hxx>
+#include <NCollection_DataMap.hxx>
 #include <Poly_Triangulation.hxx>
 #include <TColgp_Array1OfPnt.hxx>
 #include <Poly_Array1OfTriangle.hxx>
@@ -31,8 +41,58 @@
 #include <TCollection_AsciiString.hxx>
 #include <Standard_Failure.hxx>
 
+#include <chrono>
+
 using namespace godot;
 
+namespace {
+
+// Converts an instance transform (Transform3D, 12 or 16 row-major numbers, or null for identity)
+// to a rigid OpenCASCADE transformation. Non-rigid matrices are rejected by gp_Trsf.
+bool transform_from_variant(const Variant& value, gp_Trsf& trsf, String& error) {
+    trsf = gp_Trsf();
+    switch (value.get_type()) {
+        case Variant::NIL:
+            return true;
+        case Variant::TRANSFORM3D: {
+            const Transform3D transform = value;
+            const Basis& b = transform.basis;
+            trsf.SetValues(b.rows[0][0], b.rows[0][1], b.rows[0][2], transform.origin.x,
+                           b.rows[1][0], b.rows[1][1], b.rows[1][2], transform.origin.y,
+                           b.rows[2][0], b.rows[2][1], b.rows[2][2], transform.origin.z);
+            return true;
+        }
+        case Variant::ARRAY:
+        case Variant::PACKED_FLOAT32_ARRAY:
+        case Variant::PACKED_FLOAT64_ARRAY: {
+            const Array m = value;
+            if (m.size() != 12 && m.size() != 16) {
+                error = String("expected 12 or 16 matrix values, got ") + String::num(m.size());
+                return false;
+            }
+            trsf.SetValues(m[0], m[1], m[2], m[3],
+                           m[4], m[5], m[6], m[7],
+                           m[8], m[9], m[10], m[11]);
+            return true;
+        }
+        default:
+            error = String("unsupported transform type ") + Variant::get_type_name(value.get_type());
+            return false;
+    }
+}
+
+// Releases an in-memory export target if the export ends early
+struct MemoryTargetGuard {
+    String path;
+    ~MemoryTargetGuard() {
+        if (!path.is_empty()) {
+            ocgd_memory_file_take(path);
+        }
+    }
+};
+
+} // namespace
+
 ocgd_glb_exporter::ocgd_glb_exporter() {
     mesh_deflection = 0.1;
     angular_deflection = 0.5;
@@ -43,6 +103,12 @@ ocgd_glb_exporter::ocgd_glb_exporter() {
     texture_size = 512;
     default_material_name = "Material";
     mesh_optimization = false;
+    parallel_meshing = true;
+    quantize_vertices = false;
+    last_write_time_ms = 0.0;
+    last_quantize_time_ms = 0.0;
+    last_unquantized_size = 0;
+    last_export_size = 0;
     last_error = "";
     shape_colors = Dictionary();
     shape_materials = Dictionary();
@@ -60,6 +126,10 @@ void ocgd_glb_exporter::_bind_methods() {
     ClassDB::bind_method(D_METHOD("export_shape_with_options", "shape", "file_path", "options"), &ocgd_glb_exporter::export_shape_with_options);
     ClassDB::bind_method(D_METHOD("export_assembly_with_options", "shapes", "transforms", "file_path", "options"), &ocgd_glb_exporter::export_assembly_with_options);
     
+    ClassDB::bind_method(D_METHOD("export_shape_to_bytes", "shape", "options"), &ocgd_glb_exporter::export_shape_to_bytes, DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("export_shapes_to_bytes", "shapes", "options"), &ocgd_glb_exporter::export_shapes_to_bytes, DEFVAL(Dictionary()));
+    ClassDB::bind_method(D_METHOD("export_assembly_to_bytes", "shapes", "transforms", "options"), &ocgd_glb_exporter::export_assembly_to_bytes, DEFVAL(Dictionary()));
+    
     ClassDB::bind_method(D_METHOD("set_mesh_deflection", "deflection"), &ocgd_glb_exporter::set_mesh_deflection);
     ClassDB::bind_method(D_METHOD("get_mesh_deflection"), &ocgd_glb_exporter::get_mesh_deflection);
     ClassDB::bind_method(D_METHOD("set_angular_deflection", "deflection"), &ocgd_glb_exporter::set_angular_deflection);
@@ -112,6 +182,10 @@ void ocgd_glb_exporter::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_mesh_optimization"), &ocgd_glb_exporter::get_mesh_optimization);
     ClassDB::bind_method(D_METHOD("set_vertex_welding_tolerance", "tolerance"), &ocgd_glb_exporter::set_vertex_welding_tolerance);
     ClassDB::bind_method(D_METHOD("get_vertex_welding_tolerance"), &ocgd_glb_exporter::get_vertex_welding_tolerance);
+    ClassDB::bind_method(D_METHOD("set_parallel_meshing", "enable"), &ocgd_glb_exporter::set_parallel_meshing);
+    ClassDB::bind_method(D_METHOD("get_parallel_meshing"), &ocgd_glb_exporter::get_parallel_meshing);
+    ClassDB::bind_method(D_METHOD("set_quantize_vertices", "enable"), &ocgd_glb_exporter::set_quantize_vertices);
+    ClassDB::bind_method(D_METHOD("get_quantize_vertices"), &ocgd_glb_exporter::get_quantize_vertices);
 }
 
 Ref<ocgd_glb_exporter> ocgd_glb_exporter::new_exporter() {
@@ -144,6 +218,27 @@ bool ocgd_glb_exporter::export_shape_with_options(const Ref<ocgd_shape>& shape,
 bool ocgd_glb_exporter::export_assembly_with_options(const Array& shapes, const Array& transforms, const String& file_path, const Dictionary& options) {
     clear_error();
     ERR_FAIL_COND_V_MSG(file_path.is_empty(), false, "File path is empty");
+    return write_glb(shapes, transforms, file_path, options, nullptr);
+}
+
+PackedByteArray ocgd_glb_exporter::export_shape_to_bytes(const Ref<ocgd_shape>& shape, const Dictionary& options) {
+    Array shapes;
+    shapes.append(shape);
+    return export_assembly_to_bytes(shapes, Array(), options);
+}
+
+PackedByteArray ocgd_glb_exporter::export_shapes_to_bytes(const Array& shapes, const Dictionary& options) {
+    return export_assembly_to_bytes(shapes, Array(), options);
+}
+
+PackedByteArray ocgd_glb_exporter::export_assembly_to_bytes(const Array& shapes, const Array& transforms, const Dictionary& options) {
+    clear_error();
+    PackedByteArray bytes;
+    write_glb(shapes, transforms, String(), options, &bytes);
+    return bytes;
+}
+
+bool ocgd_glb_exporter::write_glb(const Array& shapes, const Array& transforms, const String& file_path, const Dictionary& options, PackedByteArray* r_bytes) {
     ERR_FAIL_COND_V_MSG(shapes.size() == 0, false, "No shapes provided for export");
     
     if (shapes.size() == 0) {
@@ -172,8 +267,26 @@ bool ocgd_glb_exporter::export_assembly_with_options(const Array& shapes, const
         if (options.has("angular_deflection")) {
             export_angular = options["angular_deflection"];
         }
+        bool export_parallel = parallel_meshing;
+        if (options.has("parallel_meshing")) {
+            export_parallel = options["parallel_meshing"];
+        }
+        bool export_quantized = quantize_vertices;
+        if (options.has("quantize_vertices")) {
+            export_quantized = options["quantize_vertices"];
+        }
         
-        // Add shapes to document
+        last_write_time_ms = 0.0;
+        last_quantize_time_ms = 0.0;
+        last_unquantized_size = 0;
+        last_export_size = 0;
+        auto write_start = std::chrono::high_resolution_clock::now();
+        
+        // Validate all shapes and transforms before doing any work
+        std::vector<TopoDS_Shape> occ_shapes;
+        std::vector<TopLoc_Location> instance_locations;
+        occ_shapes.reserve(shapes.size());
+        instance_locations.reserve(shapes.size());
         for (int i = 0; i < shapes.size(); i++) {
             Ref<ocgd_shape> shape_ref = shapes[i];
             if (shape_ref.is_null()) {
@@ -187,36 +300,74 @@ bool ocgd_glb_exporter::export_assembly_with_options(const Array& shapes, const
                 return false;
             }
             
-            TopoDS_Shape occ_shape = shape_ref->get_shape();
-            
-            // Mesh the shape before export
-            BRepMesh_IncrementalMesh mesher(occ_shape, export_deflection, Standard_False, export_angular);
-            
-            // Add shape to document
-            TDF_Label shape_label = shape_tool->AddShape(occ_shape);
-            
-            // Apply transform if provided
-            if (i < transforms.size() && transforms[i].get_type() != Variant::NIL) {
-                // Transform would be applied here - for now skip
-                // This would require implementing transform parsing from Godot data
+            gp_Trsf trsf;
+            String transform_error;
+            bool transform_ok = false;
+            try {
+                transform_ok = transform_from_variant(i < transforms.size() ? transforms[i] : Variant(), trsf, transform_error);
+            } catch (const Standard_Failure& e) {
+                transform_error = e.GetMessageString();
             }
-            
-            // Add default color if export_colors is enabled
-            if (export_colors) {
-                Quantity_Color default_color(0.7, 0.7, 0.7, Quantity_TOC_RGB);
-                color_tool->SetColor(shape_label, default_color, XCAFDoc_ColorSurf);
+            if (!transform_ok) {
+                last_error = String("Transform at index ") + String::num(i) + " is invalid: " + transform_error;
+                ERR_PRINT(last_error);
+                return false;
             }
             
-            // Add default material if export_materials is enabled
-            if (export_materials) {
-                Handle(TCollection_HAsciiString) mat_name = new TCollection_HAsciiString(default_material_name.utf8().get_data());
-                TDF_Label material_label = material_tool->AddMaterial(mat_name, Handle(TCollection_HAsciiString)(), 1.0, Handle(TCollection_HAsciiString)(), Handle(TCollection_HAsciiString)());
-                material_tool->SetMaterial(shape_label, material_label);
+            occ_shapes.push_back(shape_ref->get_shape());
+            instance_locations.push_back(TopLoc_Location(trsf));
+        }
+        
+        // Mesh all shapes in one stage so the work can be spread over all cores
+        mesh_shapes(occ_shapes, export_deflection, export_angular, export_parallel);
+        
+        // Shared material for all parts
+        TDF_Label material_label;
+        if (export_materials) {
+            Handle(TCollection_HAsciiString) mat_name = new TCollection_HAsciiString(default_material_name.utf8().get_data());
+            material_label = material_tool->AddMaterial(mat_name, Handle(TCollection_HAsciiString)(), 1.0, Handle(TCollection_HAsciiString)(), Handle(TCollection_HAsciiString)());
+        }
+        
+        // Build an assembly in which shapes sharing a TShape and orientation become one part
+        // (prototype) referenced by located components, so the writer emits one mesh with many
+        // nodes; a reversed instance gets its own prototype instead of rendering inside out
+        TDF_Label assembly_label = shape_tool->NewShape();
+        NCollection_DataMap<TopoDS_Shape, TDF_Label, TopTools_OrientedShapeMapHasher> prototypes;
+        for (size_t i = 0; i < occ_shapes.size(); i++) {
+            const TopoDS_Shape& occ_shape = occ_shapes[i];
+            const TopoDS_Shape prototype_shape = occ_shape.Located(TopLoc_Location());
+            
+            TDF_Label prototype_label;
+            if (!prototypes.Find(prototype_shape, prototype_label)) {
+                prototype_label = shape_tool->AddShape(prototype_shape, Standard_False);
+                prototypes.Bind(prototype_shape, prototype_label);
+                
+                // Add default color if export_colors is enabled
+                if (export_colors) {
+                    Quantity_Color default_color(0.7, 0.7, 0.7, Quantity_TOC_RGB);
+                    color_tool->SetColor(prototype_label, default_color, XCAFDoc_ColorSurf);
+                }
+                
+                // Add default material if export_materials is enabled
+                if (export_materials) {
+                    material_tool->SetMaterial(prototype_label, material_label);
+                }
             }
+            
+            // The shape is placed at its own location first, then moved by the instance transform
+            shape_tool->AddComponent(assembly_label, prototype_label, instance_locations[i] * occ_shape.Location());
+        }
+        shape_tool->UpdateAssemblies();
+        
+        // In-memory exports write to a path served from memory through OSD_FileSystem
+        MemoryTargetGuard memory_target;
+        const String target_path = r_bytes ? ocgd_memory_file_create_path("export.glb") : file_path;
+        if (r_bytes) {
+            memory_target.path = target_path;
         }
         
         // Create GLB writer
-        RWGltf_CafWriter writer(TCollection_AsciiString(file_path.utf8().get_data()), Standard_True);
+        RWGltf_CafWriter writer(TCollection_AsciiString(target_path.utf8().get_data()), Standard_True);
         
         // Configure writer options
         writer.SetMeshNameFormat(RWMesh_NameFormat_ProductOrInstance);
@@ -237,6 +388,54 @@ bool ocgd_glb_exporter::export_assembly_with_options(const Array& shapes, const
             return false;
         }
         
+        auto write_end = std::chrono::high_resolution_clock::now();
+        last_write_time_ms = std::chrono::duration<double, std::milli>(write_end - write_start).count();
+        
+        if (r_bytes) {
+            *r_bytes = ocgd_memory_file_take(target_path);
+            memory_target.path = String();
+            if (r_bytes->is_empty()) {
+                last_error = "GLB export produced no data";
+                ERR_PRINT(last_error);
+                return false;
+            }
+            last_unquantized_size = r_bytes->size();
+            last_export_size = r_bytes->size();
+        }
+        
+        if (export_quantized) {
+            Dictionary quantize_stats;
+            String quantize_error;
+            bool quantized = false;
+            if (r_bytes) {
+                PackedByteArray quantized_bytes;
+                quantized = ocgd_quantize_glb(*r_bytes, quantized_bytes, quantize_stats, quantize_error);
+                if (quantized) {
+                    *r_bytes = quantized_bytes;
+                }
+            } else {
+                quantized = ocgd_quantize_glb_file(file_path, quantize_stats, quantize_error);
+            }
+            
+            if (quantized) {
+                last_unquantized_size = quantize_stats["original_size"];
+                last_export_size = quantize_stats["quantized_size"];
+            } else {
+                // The unquantized GLB written above is still valid
+                WARN_PRINT(String("GLB quantization skipped: ") + quantize_error);
+            }
+            auto quantize_end = std::chrono::high_resolution_clock::now();
+            last_quantize_time_ms = std::chrono::duration<double, std::milli>(quantize_end - write_end).count();
+        }
+        
+        if (last_export_size == 0 && !r_bytes) {
+            Ref<FileAccess> written = FileAccess::open(file_path, FileAccess::READ);
+            if (written.is_valid()) {
+                last_export_size = written->get_length();
+            }
+            last_unquantized_size = last_export_size;
+        }
+        
         return true;
         
     } catch (const Standard_Failure& e) {
@@ -254,6 +453,35 @@ bool ocgd_glb_exporter::export_assembly_with_options(const Array& shapes, const
     }
 }
 
+void ocgd_glb_exporter::mesh_shapes(const std::vector<TopoDS_Shape>& shapes, double deflection, double angular, bool in_parallel) const {
+    // Collect shapes that still need meshing. Triangulations live on the shared TShape,
+    // so repeated instances of a part (same TShape, different location) are meshed once.
+    TopTools_MapOfShape seen;
+    BRep_Builder builder;
+    TopoDS_Compound pending;
+    builder.MakeCompound(pending);
+    int pending_count = 0;
+
+    for (const TopoDS_Shape& shape : shapes) {
+        TopoDS_Shape unlocated = shape.Located(TopLoc_Location());
+        if (!seen.Add(unlocated)) {
+            continue;
+        }
+        if (BRepTools::Triangulation(unlocated, deflection)) {
+            continue;
+        }
+        builder.Add(pending, unlocated);
+        pending_count++;
+    }
+
+    if (pending_count == 0) {
+        return;
+    }
+
+    // A single mesher over the compound lets BRepMesh distribute faces over its thread pool
+    BRepMesh_IncrementalMesh mesher(pending, deflection, Standard_False, angular, in_parallel ? Standard_True : Standard_False);
+}
+
 void ocgd_glb_exporter::set_mesh_deflection(double deflection) {
     ERR_FAIL_COND_MSG(deflection <= 0.0, "Mesh deflection must be positive");
     mesh_deflection = deflection;
@@ -330,6 +558,13 @@ Dictionary ocgd_glb_exporter::get_export_info() const {
     info["export_materials"] = export_materials;
     info["export_textures"] = export_textures;
     info["merge_faces"] = merge_faces;
+    info["parallel_meshing"] = parallel_meshing;
+    info["quantize_vertices"] = quantize_vertices;
+    info["last_export_size"] = last_export_size;
+    info["last_unquantized_size"] = last_unquantized_size;
+    info["last_size_ratio"] = last_unquantized_size > 0 ? double(last_export_size) / double(last_unquantized_size) : 1.0;
+    info["last_write_time_ms"] = last_write_time_ms;
+    info["last_quantize_time_ms"] = last_quantize_time_ms;
     info["texture_size"] = texture_size;
     info["default_material_name"] = default_material_name;
     info["last_error"] = last_error;
@@ -556,4 +791,20 @@ void ocgd_glb_exporter::set_vertex_welding_tolerance(double tolerance) {
 double ocgd_glb_exporter::get_vertex_welding_tolerance() const {
     // Return vertex welding tolerance
     return 0.001;
-}
\ No newline at end of file
+}
+
+void ocgd_glb_exporter::set_parallel_meshing(bool enable) {
+    parallel_meshing = enable;
+}
+
+bool ocgd_glb_exporter::get_parallel_meshing() const {
+    return parallel_meshing;
+}
+
+void ocgd_glb_exporter::set_quantize_vertices(bool enable) {
+    quantize_vertices = enable;
+}
+
+bool ocgd_glb_exporter::get_quantize_vertices() const {
+    return quantize_vertices;
+}
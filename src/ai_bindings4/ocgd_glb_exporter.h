@@ -6,8 +6,11 @@
 #include <godot_cpp/variant/array.hpp>
 #include <godot_cpp/variant/dictionary.hpp>
 #include <godot_cpp/variant/vector3.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
 #include <godot_cpp/classes/ref.hpp>
 
+#include <vector>
+
 // Forward declarations for OpenCASCADE
 class TopoDS_Shape;
 
@@ -27,11 +30,25 @@ private:
     int texture_size;
     godot::String default_material_name;
     bool mesh_optimization;
+    bool parallel_meshing;
+    bool quantize_vertices;
+    
+    // Size/time of the last export, reported by get_export_info
+    double last_write_time_ms;
+    double last_quantize_time_ms;
+    int64_t last_unquantized_size;
+    int64_t last_export_size;
     
     // Shape-to-color and material mappings
     godot::Dictionary shape_colors;
     godot::Dictionary shape_materials;
 
+    // Shared implementation of file and in-memory export; writes to r_bytes when it is not null
+    bool write_glb(const godot::Array& shapes, const godot::Array& transforms, const godot::String& file_path, const godot::Dictionary& options, godot::PackedByteArray* r_bytes);
+    
+    // Triangulate all shapes up front, skipping those already meshed finely enough
+    void mesh_shapes(const std::vector<TopoDS_Shape>& shapes, double deflection, double angular, bool in_parallel) const;
+
 protected:
     static void _bind_methods();
 
@@ -51,6 +68,11 @@ public:
     bool export_shape_with_options(const godot::Ref<ocgd_shape>& shape, const godot::String& file_path, const godot::Dictionary& options);
     bool export_assembly_with_options(const godot::Array& shapes, const godot::Array& transforms, const godot::String& file_path, const godot::Dictionary& options);
     
+    // Export to an in-memory GLB (empty on failure), e.g. for GLTFDocument::append_from_buffer
+    godot::PackedByteArray export_shape_to_bytes(const godot::Ref<ocgd_shape>& shape, const godot::Dictionary& options = godot::Dictionary());
+    godot::PackedByteArray export_shapes_to_bytes(const godot::Array& shapes, const godot::Dictionary& options = godot::Dictionary());
+    godot::PackedByteArray export_assembly_to_bytes(const godot::Array& shapes, const godot::Array& transforms, const godot::Dictionary& options = godot::Dictionary());
+    
     // Configuration methods for mesh quality
     void set_mesh_deflection(double deflection);
     double get_mesh_deflection() const;
@@ -120,6 +142,14 @@ public:
     bool get_mesh_optimization() const;
     void set_vertex_welding_tolerance(double tolerance);
     double get_vertex_welding_tolerance() const;
+
+    // Concurrent triangulation of all shapes before export
+    void set_parallel_meshing(bool enable);
+    bool get_parallel_meshing() const;
+    
+    // KHR_mesh_quantization vertex streams (int16 positions, int8 normals, uint16 indices)
+    void set_quantize_vertices(bool enable);
+    bool get_quantize_vertices() const;
 };
 
 #endif // OCGD_GLB_EXPORTER_H
\ No newline at end of file
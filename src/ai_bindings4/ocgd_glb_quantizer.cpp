@@ -0,0 +1,588 @@
+#include "ocgd_glb_quantizer.h"
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/json.hpp>
+#include <godot_cpp/variant/array.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace godot;
+
+namespace {
+
+const uint32_t GLB_MAGIC = 0x46546C67;      // "glTF"
+const uint32_t GLB_CHUNK_JSON = 0x4E4F534A; // "JSON"
+const uint32_t GLB_CHUNK_BIN = 0x004E4942;  // "BIN\0"
+
+const int GLTF_BYTE = 5120;
+const int GLTF_UNSIGNED_BYTE = 5121;
+const int GLTF_SHORT = 5122;
+const int GLTF_UNSIGNED_SHORT = 5123;
+const int GLTF_UNSIGNED_INT = 5125;
+const int GLTF_FLOAT = 5126;
+
+const int GLTF_ARRAY_BUFFER = 34962;
+const int GLTF_ELEMENT_ARRAY_BUFFER = 34963;
+
+enum AccessorRole {
+    ROLE_OTHER,
+    ROLE_POSITION,
+    ROLE_NORMAL,
+    ROLE_INDICES
+};
+
+uint32_t read_u32(const uint8_t* data) {
+    return uint32_t(data[0]) | (uint32_t(data[1]) << 8) | (uint32_t(data[2]) << 16) | (uint32_t(data[3]) << 24);
+}
+
+void append_u32(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(uint8_t(value & 0xFF));
+    out.push_back(uint8_t((value >> 8) & 0xFF));
+    out.push_back(uint8_t((value >> 16) & 0xFF));
+    out.push_back(uint8_t((value >> 24) & 0xFF));
+}
+
+float read_f32(const uint8_t* data) {
+    const uint32_t bits = read_u32(data);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+int component_size(int component_type) {
+    switch (component_type) {
+        case GLTF_BYTE:
+        case GLTF_UNSIGNED_BYTE:
+            return 1;
+        case GLTF_SHORT:
+        case GLTF_UNSIGNED_SHORT:
+            return 2;
+        case GLTF_UNSIGNED_INT:
+        case GLTF_FLOAT:
+            return 4;
+        default:
+            return 0;
+    }
+}
+
+int component_count(const String& type) {
+    if (type == "SCALAR") return 1;
+    if (type == "VEC2") return 2;
+    if (type == "VEC3") return 3;
+    if (type == "VEC4") return 4;
+    if (type == "MAT2") return 4;
+    if (type == "MAT3") return 9;
+    if (type == "MAT4") return 16;
+    return 0;
+}
+
+// Location of an accessor's elements inside the BIN chunk
+struct AccessorView {
+    const uint8_t* data = nullptr;
+    int64_t count = 0;
+    int64_t stride = 0;
+    int64_t element_size = 0;
+    int component_type = 0;
+    int components = 0;
+};
+
+bool get_accessor_view(const Array& accessors, const Array& buffer_views, const PackedByteArray& bin,
+                       int index, AccessorView& view) {
+    const Dictionary accessor = accessors[index];
+    if (!accessor.has("bufferView") || accessor.has("sparse")) {
+        return false;
+    }
+
+    const int view_index = accessor["bufferView"];
+    if (view_index < 0 || view_index >= buffer_views.size()) {
+        return false;
+    }
+
+    const Dictionary buffer_view = buffer_views[view_index];
+    if (int(buffer_view.get("buffer", 0)) != 0) {
+        return false;
+    }
+
+    view.component_type = accessor["componentType"];
+    view.components = component_count(accessor["type"]);
+    view.count = int64_t(accessor["count"]);
+    view.element_size = int64_t(component_size(view.component_type)) * view.components;
+    view.stride = int64_t(buffer_view.get("byteStride", view.element_size));
+    if (view.element_size <= 0 || view.stride < view.element_size || view.count < 0) {
+        return false;
+    }
+
+    const int64_t view_offset = int64_t(buffer_view.get("byteOffset", 0));
+    const int64_t view_length = int64_t(buffer_view["byteLength"]);
+    const int64_t accessor_offset = int64_t(accessor.get("byteOffset", 0));
+    const int64_t used = view.count > 0 ? accessor_offset + (view.count - 1) * view.stride + view.element_size : 0;
+    if (view_offset < 0 || view_offset + view_length > bin.size() || used > view_length) {
+        return false;
+    }
+
+    view.data = bin.ptr() + view_offset + accessor_offset;
+    return true;
+}
+
+// Accumulates the rewritten BIN chunk and its buffer views
+struct BinBuilder {
+    std::vector<uint8_t> data;
+    Array views;
+
+    int add_view(const uint8_t* bytes, int64_t length, int target, int64_t stride) {
+        while (data.size() % 4 != 0) {
+            data.push_back(0);
+        }
+
+        Dictionary view;
+        view["buffer"] = 0;
+        view["byteOffset"] = int64_t(data.size());
+        view["byteLength"] = length;
+        if (stride > 0) {
+            view["byteStride"] = stride;
+        }
+        if (target > 0) {
+            view["target"] = target;
+        }
+
+        data.insert(data.end(), bytes, bytes + length);
+        views.append(view);
+        return views.size() - 1;
+    }
+};
+
+// Mesh-local dequantization: position = center + scale * normalized_int16
+struct MeshQuantization {
+    bool enabled = false;
+    double center[3] = { 0.0, 0.0, 0.0 };
+    double scale = 1.0;
+};
+
+// JSON numbers are parsed as floats; write whole numbers (indices, counts, enums) as integers
+Variant normalize_json_numbers(const Variant& value) {
+    switch (value.get_type()) {
+        case Variant::FLOAT: {
+            const double number = value;
+            if (std::floor(number) == number && std::fabs(number) < 9.0e15) {
+                return int64_t(number);
+            }
+            return value;
+        }
+        case Variant::DICTIONARY: {
+            Dictionary dictionary = value;
+            const Array keys = dictionary.keys();
+            for (int i = 0; i < keys.size(); i++) {
+                dictionary[keys[i]] = normalize_json_numbers(dictionary[keys[i]]);
+            }
+            return dictionary;
+        }
+        case Variant::ARRAY: {
+            Array array = value;
+            for (int i = 0; i < array.size(); i++) {
+                array[i] = normalize_json_numbers(array[i]);
+            }
+            return array;
+        }
+        default:
+            return value;
+    }
+}
+
+void add_required_extension(Dictionary& json, const char* extension) {
+    const char* lists[] = { "extensionsUsed", "extensionsRequired" };
+    for (const char* list_name : lists) {
+        Array list = json.get(list_name, Array());
+        if (!list.has(extension)) {
+            list.append(extension);
+        }
+        json[list_name] = list;
+    }
+}
+
+int16_t quantize_snorm16(double value) {
+    return int16_t(std::lround(std::max(-1.0, std::min(1.0, value)) * 32767.0));
+}
+
+int8_t quantize_snorm8(double value) {
+    return int8_t(std::lround(std::max(-1.0, std::min(1.0, value)) * 127.0));
+}
+
+} // namespace
+
+bool ocgd_quantize_glb(const PackedByteArray& bytes, PackedByteArray& output, Dictionary& stats, String& error) {
+    const int64_t original_size = bytes.size();
+
+    // --- Parse the GLB container ---
+    if (original_size < 20 || read_u32(bytes.ptr()) != GLB_MAGIC || read_u32(bytes.ptr() + 4) != 2) {
+        error = "Not a glTF 2.0 binary file";
+        return false;
+    }
+
+    const int64_t json_length = read_u32(bytes.ptr() + 12);
+    if (read_u32(bytes.ptr() + 16) != GLB_CHUNK_JSON || 20 + json_length > original_size) {
+        error = "Missing JSON chunk";
+        return false;
+    }
+
+    PackedByteArray bin;
+    const int64_t bin_header = 20 + json_length;
+    if (bin_header + 8 <= original_size && read_u32(bytes.ptr() + bin_header + 4) == GLB_CHUNK_BIN) {
+        const int64_t bin_length = read_u32(bytes.ptr() + bin_header);
+        if (bin_header + 8 + bin_length > original_size) {
+            error = "Truncated BIN chunk";
+            return false;
+        }
+        bin = bytes.slice(bin_header + 8, bin_header + 8 + bin_length);
+    }
+
+    const Variant parsed = JSON::parse_string(String::utf8(reinterpret_cast<const char*>(bytes.ptr() + 20), json_length));
+    if (parsed.get_type() != Variant::DICTIONARY) {
+        error = "Invalid JSON chunk";
+        return false;
+    }
+
+    Dictionary json = parsed;
+    Array meshes = json.get("meshes", Array());
+    Array accessors = json.get("accessors", Array());
+    const Array buffer_views = json.get("bufferViews", Array());
+    Array nodes = json.get("nodes", Array());
+    Array images = json.get("images", Array());
+
+    if (meshes.is_empty() || bin.is_empty()) {
+        error = "No mesh data to quantize";
+        return false;
+    }
+
+    // --- Classify accessors by their use in mesh primitives ---
+    const int accessor_count = accessors.size();
+    std::vector<int> roles(accessor_count, ROLE_OTHER);
+    std::vector<int> position_mesh(accessor_count, -1); // -2 = shared between meshes
+    std::vector<MeshQuantization> mesh_quantization(meshes.size());
+
+    for (int m = 0; m < meshes.size(); m++) {
+        const Dictionary mesh = meshes[m];
+        const Array primitives = mesh.get("primitives", Array());
+        for (int p = 0; p < primitives.size(); p++) {
+            const Dictionary primitive = primitives[p];
+            if (primitive.has("targets")) {
+                error = "Morph targets are not supported";
+                return false;
+            }
+
+            const Dictionary attributes = primitive.get("attributes", Dictionary());
+            if (attributes.has("POSITION")) {
+                const int index = attributes["POSITION"];
+                if (index >= 0 && index < accessor_count) {
+                    roles[index] = ROLE_POSITION;
+                    position_mesh[index] = (position_mesh[index] == -1 || position_mesh[index] == m) ? m : -2;
+                }
+            }
+            if (attributes.has("NORMAL")) {
+                const int index = attributes["NORMAL"];
+                if (index >= 0 && index < accessor_count) {
+                    roles[index] = ROLE_NORMAL;
+                }
+            }
+            if (primitive.has("indices")) {
+                const int index = primitive["indices"];
+                if (index >= 0 && index < accessor_count) {
+                    roles[index] = ROLE_INDICES;
+                }
+            }
+        }
+    }
+
+    // --- Per-mesh position bounds; meshes sharing position data with others stay float ---
+    for (int m = 0; m < meshes.size(); m++) {
+        double min_corner[3] = { 1e300, 1e300, 1e300 };
+        double max_corner[3] = { -1e300, -1e300, -1e300 };
+        bool usable = true;
+
+        const Dictionary mesh = meshes[m];
+        const Array primitives = mesh.get("primitives", Array());
+        for (int p = 0; p < primitives.size() && usable; p++) {
+            const Dictionary attributes = Dictionary(primitives[p]).get("attributes", Dictionary());
+            if (!attributes.has("POSITION")) {
+                continue;
+            }
+
+            const int a = attributes["POSITION"];
+            AccessorView view;
+            if (a < 0 || a >= accessor_count || position_mesh[a] != m ||
+                !get_accessor_view(accessors, buffer_views, bin, a, view) ||
+                view.component_type != GLTF_FLOAT || view.components != 3) {
+                usable = false;
+                break;
+            }
+            for (int64_t v = 0; v < view.count; v++) {
+                const uint8_t* element = view.data + v * view.stride;
+                for (int c = 0; c < 3; c++) {
+                    const double coordinate = read_f32(element + 4 * c);
+                    min_corner[c] = std::min(min_corner[c], coordinate);
+                    max_corner[c] = std::max(max_corner[c], coordinate);
+                }
+            }
+        }
+
+        // Empty meshes have nothing to quantize
+        if (min_corner[0] > max_corner[0]) {
+            usable = false;
+        }
+
+        if (!usable) {
+            continue;
+        }
+
+        MeshQuantization& quantization = mesh_quantization[m];
+        double half_extent = 0.0;
+        for (int c = 0; c < 3; c++) {
+            quantization.center[c] = 0.5 * (min_corner[c] + max_corner[c]);
+            half_extent = std::max(half_extent, 0.5 * (max_corner[c] - min_corner[c]));
+        }
+        // Uniform scale keeps normals valid without renormalization in the node transform
+        quantization.scale = half_extent > 0.0 ? half_extent : 1.0;
+        quantization.enabled = true;
+    }
+
+    // --- Rewrite the BIN chunk, one buffer view per accessor ---
+    BinBuilder builder;
+    int quantized_accessors = 0;
+    bool uses_quantization = false;
+
+    for (int a = 0; a < accessor_count; a++) {
+        Dictionary accessor = accessors[a];
+        if (!accessor.has("bufferView")) {
+            continue;
+        }
+
+        AccessorView view;
+        if (!get_accessor_view(accessors, buffer_views, bin, a, view)) {
+            error = String("Unsupported layout of accessor ") + String::num(a);
+            return false;
+        }
+
+        const int role = roles[a];
+        const bool float_vec3 = view.component_type == GLTF_FLOAT && view.components == 3;
+        int new_view = -1;
+
+        if (role == ROLE_POSITION && float_vec3 && position_mesh[a] >= 0 && mesh_quantization[position_mesh[a]].enabled) {
+            // int16 xyz padded to 8 bytes: vertex attribute strides must be multiples of 4
+            const MeshQuantization& quantization = mesh_quantization[position_mesh[a]];
+            std::vector<int16_t> quantized(size_t(view.count) * 4, 0);
+            int64_t min_q[3] = { 32767, 32767, 32767 };
+            int64_t max_q[3] = { -32767, -32767, -32767 };
+            for (int64_t v = 0; v < view.count; v++) {
+                const uint8_t* element = view.data + v * view.stride;
+                for (int c = 0; c < 3; c++) {
+                    const double normalized = (read_f32(element + 4 * c) - quantization.center[c]) / quantization.scale;
+                    const int16_t q = quantize_snorm16(normalized);
+                    quantized[size_t(v) * 4 + c] = q;
+                    min_q[c] = std::min<int64_t>(min_q[c], q);
+                    max_q[c] = std::max<int64_t>(max_q[c], q);
+                }
+            }
+            new_view = builder.add_view(reinterpret_cast<const uint8_t*>(quantized.data()), view.count * 8, GLTF_ARRAY_BUFFER, 8);
+
+            accessor["componentType"] = GLTF_SHORT;
+            accessor["normalized"] = true;
+            if (view.count > 0) {
+                Array min_values;
+                Array max_values;
+                for (int c = 0; c < 3; c++) {
+                    min_values.append(min_q[c]);
+                    max_values.append(max_q[c]);
+                }
+                accessor["min"] = min_values;
+                accessor["max"] = max_values;
+            }
+            uses_quantization = true;
+            quantized_accessors++;
+        } else if (role == ROLE_NORMAL && float_vec3) {
+            // int8 xyz padded to 4 bytes
+            std::vector<int8_t> quantized(size_t(view.count) * 4, 0);
+            for (int64_t v = 0; v < view.count; v++) {
+                const uint8_t* element = view.data + v * view.stride;
+                double n[3] = { read_f32(element), read_f32(element + 4), read_f32(element + 8) };
+                const double length = std::sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+                for (int c = 0; c < 3; c++) {
+                    quantized[size_t(v) * 4 + c] = quantize_snorm8(length > 0.0 ? n[c] / length : 0.0);
+                }
+            }
+            new_view = builder.add_view(reinterpret_cast<const uint8_t*>(quantized.data()), view.count * 4, GLTF_ARRAY_BUFFER, 4);
+
+            accessor["componentType"] = GLTF_BYTE;
+            accessor["normalized"] = true;
+            accessor.erase("min");
+            accessor.erase("max");
+            uses_quantization = true;
+            quantized_accessors++;
+        } else if (role == ROLE_INDICES && view.component_type == GLTF_UNSIGNED_INT && view.components == 1) {
+            uint32_t max_index = 0;
+            for (int64_t i = 0; i < view.count; i++) {
+                max_index = std::max(max_index, read_u32(view.data + i * view.stride));
+            }
+
+            // 65535 is reserved (primitive restart) for unsigned short indices
+            if (max_index < 65535) {
+                std::vector<uint16_t> narrowed(size_t(view.count));
+                for (int64_t i = 0; i < view.count; i++) {
+                    narrowed[size_t(i)] = uint16_t(read_u32(view.data + i * view.stride));
+                }
+                new_view = builder.add_view(reinterpret_cast<const uint8_t*>(narrowed.data()), view.count * 2, GLTF_ELEMENT_ARRAY_BUFFER, 0);
+                accessor["componentType"] = GLTF_UNSIGNED_SHORT;
+                if (accessor.has("max")) {
+                    Array max_values;
+                    max_values.append(int64_t(max_index));
+                    accessor["max"] = max_values;
+                }
+                quantized_accessors++;
+            }
+        }
+
+        if (new_view < 0) {
+            // Copy unchanged, tightly packed
+            std::vector<uint8_t> packed(size_t(view.count * view.element_size));
+            for (int64_t v = 0; v < view.count; v++) {
+                std::memcpy(packed.data() + v * view.element_size, view.data + v * view.stride, size_t(view.element_size));
+            }
+            const int target = role == ROLE_INDICES ? GLTF_ELEMENT_ARRAY_BUFFER : (role == ROLE_OTHER ? 0 : GLTF_ARRAY_BUFFER);
+            new_view = builder.add_view(packed.data(), int64_t(packed.size()), target, 0);
+        }
+
+        accessor["bufferView"] = new_view;
+        accessor.erase("byteOffset");
+    }
+
+    // Buffer views holding embedded images are carried over as-is
+    for (int i = 0; i < images.size(); i++) {
+        Dictionary image = images[i];
+        if (!image.has("bufferView")) {
+            continue;
+        }
+        const Dictionary old_view = buffer_views[int(image["bufferView"])];
+        const int64_t offset = int64_t(old_view.get("byteOffset", 0));
+        const int64_t length = int64_t(old_view["byteLength"]);
+        if (offset < 0 || offset + length > bin.size()) {
+            error = "Invalid image buffer view";
+            return false;
+        }
+        image["bufferView"] = builder.add_view(bin.ptr() + offset, length, 0, 0);
+    }
+
+    // --- Move the dequantization transform to a child node of every mesh instance ---
+    int quantized_meshes = 0;
+    for (int m = 0; m < meshes.size(); m++) {
+        if (mesh_quantization[m].enabled) {
+            quantized_meshes++;
+        }
+    }
+
+    const int original_node_count = nodes.size();
+    for (int n = 0; n < original_node_count; n++) {
+        Dictionary node = nodes[n];
+        if (!node.has("mesh")) {
+            continue;
+        }
+        const int mesh_index = node["mesh"];
+        if (mesh_index < 0 || mesh_index >= meshes.size() || !mesh_quantization[mesh_index].enabled) {
+            continue;
+        }
+
+        const MeshQuantization& quantization = mesh_quantization[mesh_index];
+        Dictionary mesh_node;
+        mesh_node["mesh"] = mesh_index;
+        if (node.has("name")) {
+            mesh_node["name"] = node["name"];
+        }
+        Array translation;
+        Array scale;
+        for (int c = 0; c < 3; c++) {
+            translation.append(quantization.center[c]);
+            scale.append(quantization.scale);
+        }
+        mesh_node["translation"] = translation;
+        mesh_node["scale"] = scale;
+
+        nodes.append(mesh_node);
+        Array children = node.get("children", Array());
+        children.append(nodes.size() - 1);
+        node["children"] = children;
+        node.erase("mesh");
+    }
+
+    // --- Finalize JSON ---
+    json["bufferViews"] = builder.views;
+    Array buffers = json.get("buffers", Array());
+    if (buffers.is_empty()) {
+        buffers.append(Dictionary());
+    }
+    Dictionary buffer = buffers[0];
+    buffer["byteLength"] = int64_t(builder.data.size());
+    buffer.erase("uri");
+    json["buffers"] = buffers;
+
+    if (uses_quantization) {
+        add_required_extension(json, "KHR_mesh_quantization");
+    }
+
+    const Dictionary normalized_json = normalize_json_numbers(json);
+    const CharString json_text = JSON::stringify(normalized_json, "", false, true).utf8();
+
+    // --- Write the GLB container ---
+    std::vector<uint8_t> json_chunk(json_text.get_data(), json_text.get_data() + json_text.length());
+    while (json_chunk.size() % 4 != 0) {
+        json_chunk.push_back(' ');
+    }
+    while (builder.data.size() % 4 != 0) {
+        builder.data.push_back(0);
+    }
+
+    std::vector<uint8_t> header;
+    const uint32_t total_length = uint32_t(12 + 8 + json_chunk.size() + 8 + builder.data.size());
+    append_u32(header, GLB_MAGIC);
+    append_u32(header, 2);
+    append_u32(header, total_length);
+    append_u32(header, uint32_t(json_chunk.size()));
+    append_u32(header, GLB_CHUNK_JSON);
+
+    output.resize(total_length);
+    uint8_t* out = output.ptrw();
+    std::memcpy(out, header.data(), header.size());
+    out += header.size();
+    std::memcpy(out, json_chunk.data(), json_chunk.size());
+    out += json_chunk.size();
+    std::vector<uint8_t> bin_header_bytes;
+    append_u32(bin_header_bytes, uint32_t(builder.data.size()));
+    append_u32(bin_header_bytes, GLB_CHUNK_BIN);
+    std::memcpy(out, bin_header_bytes.data(), bin_header_bytes.size());
+    out += bin_header_bytes.size();
+    std::memcpy(out, builder.data.data(), builder.data.size());
+
+    stats["original_size"] = original_size;
+    stats["quantized_size"] = int64_t(total_length);
+    stats["quantized_meshes"] = quantized_meshes;
+    stats["quantized_accessors"] = quantized_accessors;
+    return true;
+}
+
+bool ocgd_quantize_glb_file(const String& file_path, Dictionary& stats, String& error) {
+    const PackedByteArray bytes = FileAccess::get_file_as_bytes(file_path);
+
+    PackedByteArray output;
+    if (!ocgd_quantize_glb(bytes, output, stats, error)) {
+        return false;
+    }
+
+    Ref<FileAccess> file = FileAccess::open(file_path, FileAccess::WRITE);
+    if (file.is_null()) {
+        error = String("Cannot open '") + file_path + "' for writing";
+        return false;
+    }
+    file->store_buffer(output);
+    return true;
+}
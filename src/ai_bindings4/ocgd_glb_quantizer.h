@@ -0,0 +1,25 @@
+#ifndef OCGD_GLB_QUANTIZER_H
+#define OCGD_GLB_QUANTIZER_H
+
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+// Internal post-processing step of ocgd_glb_exporter.
+//
+// Rewrites the vertex streams of a GLB file written by RWGltf_CafWriter to the
+// KHR_mesh_quantization layout:
+// - positions as normalized int16, with the per-mesh dequantization (translation and
+//   uniform scale) moved to a child node of every node instancing the mesh
+// - normals as normalized int8
+// - indices as uint16 wherever all indices of an accessor fit
+// Texture coordinates and other attributes are kept unchanged.
+//
+// On success stats receives "original_size", "quantized_size", "quantized_meshes" and
+// "quantized_accessors". On failure error describes the problem.
+bool ocgd_quantize_glb(const godot::PackedByteArray& glb, godot::PackedByteArray& output, godot::Dictionary& stats, godot::String& error);
+
+// Same as ocgd_quantize_glb, overwriting the file in place (left untouched on failure)
+bool ocgd_quantize_glb_file(const godot::String& file_path, godot::Dictionary& stats, godot::String& error);
+
+#endif // OCGD_GLB_QUANTIZER_H
@@ -1,9 +1,12 @@
 #include "ocgd_measurement_tool.h"
 #include "ocgd_shape.h"
+#include "../ai_bindings/ocgd_MeshFileParser.hxx"
+#include "../ai_bindings/ocgd_SpatialQuery.hxx"
 
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 #include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
 
 // OpenCASCADE includes
 #include <TopoDS_Shape.hxx>
@@ -36,6 +39,7 @@
 #include <TopoDS.hxx>
 #include <BRepGProp_Face.hxx>
 #include <GCPnts_AbscissaPoint.hxx>
+#include <GCPnts_QuasiUniformDeflection.hxx>
 #include <TopoDS_Wire.hxx>
 #include <Extrema_ExtCC.hxx>
 #include <Extrema_POnCurv.hxx>
@@ -43,15 +47,87 @@
 #include <Precision.hxx>
 #include <GeomAbs_SurfaceType.hxx>
 #include <GeomAbs_CurveType.hxx>
+#include <BRepAlgoAPI_Common.hxx>
 #include <BRepAlgoAPI_Section.hxx>
+#include <BRep_Builder.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopTools_ListOfShape.hxx>
 #include <BRepBuilderAPI_MakeFace.hxx>
 #include <gp_Cylinder.hxx>
 #include <gp_Sphere.hxx>
 #include <gp_Cone.hxx>
 #include <math.h>
+#include <algorithm>
+#include <vector>
 
 using namespace godot;
 
+namespace {
+
+// Wall thickness and interference are measured on triangulations whose linear deflection is
+// this fraction of the bounding box diagonal; high precision mode meshes finer and refines
+// thickness onto the surfaces
+const double MESH_DEFLECTION_RATIO = 0.002;
+const double HIGH_PRECISION_MESH_DEFLECTION_RATIO = 0.0005;
+
+double mesh_deflection(const TopoDS_Shape& shape, bool high_precision) {
+    Bnd_Box box;
+    BRepBndLib::Add(shape, box);
+    if (box.IsVoid()) {
+        return 0.1;
+    }
+    return sqrt(box.SquareExtent()) * (high_precision ? HIGH_PRECISION_MESH_DEFLECTION_RATIO : MESH_DEFLECTION_RATIO);
+}
+
+Ref<ocgd_SpatialQuery> build_mesh_query(const TopoDS_Shape& shape, double deflection, bool refine_to_surface) {
+    Ref<ocgd_SpatialQuery> query;
+    query.instantiate();
+    query->set_linear_deflection(deflection);
+    query->set_refine_to_surface(refine_to_surface);
+
+    if (!query->build_occt_shape(shape)) {
+        return Ref<ocgd_SpatialQuery>();
+    }
+    return query;
+}
+
+// Queries kept by each tool; measuring interference uses two at once
+const size_t MAX_CACHED_MESH_QUERIES = 4;
+
+} // namespace
+
+struct ocgd_measurement_tool::MeshQueryCache {
+    struct Entry {
+        TopoDS_Shape shape;
+        double deflection;
+        bool refine_to_surface;
+        Ref<ocgd_SpatialQuery> query;
+    };
+
+    std::vector<Entry> entries; // least recently used first
+};
+
+Ref<ocgd_SpatialQuery> ocgd_measurement_tool::mesh_query(const TopoDS_Shape& shape, double deflection, bool refine_to_surface) {
+    std::vector<MeshQueryCache::Entry>& entries = mesh_query_cache->entries;
+    for (size_t i = 0; i < entries.size(); i++) {
+        if (entries[i].shape.IsEqual(shape) && entries[i].deflection == deflection && entries[i].refine_to_surface == refine_to_surface) {
+            MeshQueryCache::Entry entry = entries[i];
+            entries.erase(entries.begin() + i);
+            entries.push_back(entry);
+            return entry.query;
+        }
+    }
+
+    Ref<ocgd_SpatialQuery> query = build_mesh_query(shape, deflection, refine_to_surface);
+    if (query.is_valid()) {
+        if (entries.size() >= MAX_CACHED_MESH_QUERIES) {
+            entries.erase(entries.begin());
+        }
+        entries.push_back({shape, deflection, refine_to_surface, query});
+    }
+    return query;
+}
+
 ocgd_measurement_tool::ocgd_measurement_tool() {
     precision_tolerance = Precision::Confusion();
     use_high_precision = false;
@@ -59,7 +135,9 @@ ocgd_measurement_tool::ocgd_measurement_tool() {
     measurement_units = "mm";
     unit_scale_factor = 1.0;
     validate_inputs = true;
+    compute_overlap_volume = false;
     last_error = "";
+    mesh_query_cache = std::make_unique<MeshQueryCache>();
 }
 
 ocgd_measurement_tool::~ocgd_measurement_tool() {
@@ -109,10 +187,15 @@ void ocgd_measurement_tool::_bind_methods() {
     ClassDB::bind_method(D_METHOD("measure_hole_diameter", "shape", "face_index"), &ocgd_measurement_tool::measure_hole_diameter);
     ClassDB::bind_method(D_METHOD("measure_fillet_radius", "shape", "face_index"), &ocgd_measurement_tool::measure_fillet_radius);
     ClassDB::bind_method(D_METHOD("measure_wall_thickness", "shape", "point", "direction"), &ocgd_measurement_tool::measure_wall_thickness);
+    ClassDB::bind_method(D_METHOD("measure_thickness_analysis", "shape"), &ocgd_measurement_tool::measure_thickness_analysis);
+    ClassDB::bind_method(D_METHOD("measure_minimum_wall_thickness", "shape"), &ocgd_measurement_tool::measure_minimum_wall_thickness);
+    ClassDB::bind_method(D_METHOD("measure_thickness_variations", "shape", "num_samples"), &ocgd_measurement_tool::measure_thickness_variations);
     
     // Clearance and interference
     ClassDB::bind_method(D_METHOD("measure_clearance", "shape1", "shape2"), &ocgd_measurement_tool::measure_clearance);
     ClassDB::bind_method(D_METHOD("measure_interference_analysis", "shape1", "shape2"), &ocgd_measurement_tool::measure_interference_analysis);
+    ClassDB::bind_method(D_METHOD("measure_interference_points", "shape1", "shape2"), &ocgd_measurement_tool::measure_interference_points);
+    ClassDB::bind_method(D_METHOD("measure_penetration_depth", "shape1", "shape2"), &ocgd_measurement_tool::measure_penetration_depth);
     
     // Configuration methods
     ClassDB::bind_method(D_METHOD("set_precision_tolerance", "tolerance"), &ocgd_measurement_tool::set_precision_tolerance);
@@ -123,6 +206,8 @@ void ocgd_measurement_tool::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_measurement_units"), &ocgd_measurement_tool::get_measurement_units);
     ClassDB::bind_method(D_METHOD("set_unit_scale_factor", "scale"), &ocgd_measurement_tool::set_unit_scale_factor);
     ClassDB::bind_method(D_METHOD("get_unit_scale_factor"), &ocgd_measurement_tool::get_unit_scale_factor);
+    ClassDB::bind_method(D_METHOD("set_compute_overlap_volume", "compute"), &ocgd_measurement_tool::set_compute_overlap_volume);
+    ClassDB::bind_method(D_METHOD("get_compute_overlap_volume"), &ocgd_measurement_tool::get_compute_overlap_volume);
     
     // Validation methods
     ClassDB::bind_method(D_METHOD("validate_shape", "shape"), &ocgd_measurement_tool::validate_shape);
@@ -873,6 +958,14 @@ bool ocgd_measurement_tool::get_validate_inputs() const {
     return validate_inputs;
 }
 
+void ocgd_measurement_tool::set_compute_overlap_volume(bool compute) {
+    compute_overlap_volume = compute;
+}
+
+bool ocgd_measurement_tool::get_compute_overlap_volume() const {
+    return compute_overlap_volume;
+}
+
 // Unit conversion methods
 double ocgd_measurement_tool::convert_length(double value, const String& from_units, const String& to_units) {
     // Convert to mm first, then to target units
@@ -1170,10 +1263,170 @@ double ocgd_measurement_tool::measure_hole_diameter(const Ref<ocgd_shape>& shape
 double ocgd_measurement_tool::measure_fillet_radius(const Ref<ocgd_shape>& shape, int face_index) { return -1.0; }
 double ocgd_measurement_tool::measure_chamfer_distance(const Ref<ocgd_shape>& shape, int face_index) { return -1.0; }
 Dictionary ocgd_measurement_tool::measure_thread_pitch(const Ref<ocgd_shape>& shape) { return Dictionary(); }
-double ocgd_measurement_tool::measure_wall_thickness(const Ref<ocgd_shape>& shape, const Vector3& point, const Vector3& direction) { return -1.0; }
-Dictionary ocgd_measurement_tool::measure_thickness_analysis(const Ref<ocgd_shape>& shape) { return Dictionary(); }
-double ocgd_measurement_tool::measure_minimum_wall_thickness(const Ref<ocgd_shape>& shape) { return -1.0; }
-Array ocgd_measurement_tool::measure_thickness_variations(const Ref<ocgd_shape>& shape, int num_samples) { return Array(); }
+
+// Thickness and wall measurements
+double ocgd_measurement_tool::measure_wall_thickness(const Ref<ocgd_shape>& shape, const Vector3& point, const Vector3& direction) {
+    ERR_FAIL_NULL_V_MSG(shape.ptr(), -1.0, "Shape is null");
+
+    try {
+        TopoDS_Shape occ_shape = shape->get_shape();
+        if (validate_inputs && !ocgd_MeshFileParser::is_mesh_only(occ_shape) && !validate_shape(shape)) {
+            return -1.0;
+        }
+        if (direction.length_squared() == 0.0) {
+            last_error = "Thickness direction is zero";
+            ERR_PRINT(last_error);
+            return -1.0;
+        }
+
+        Ref<ocgd_SpatialQuery> query = mesh_query(occ_shape, mesh_deflection(occ_shape, use_high_precision), use_high_precision);
+        if (query.is_null()) {
+            last_error = "Failed to triangulate shape for wall thickness";
+            ERR_PRINT(last_error);
+            return -1.0;
+        }
+
+        PackedVector3Array origins;
+        PackedVector3Array directions;
+        origins.push_back(point);
+        directions.push_back(direction);
+        Dictionary hits = query->intersect_rays(origins, directions);
+        if (hits.is_empty()) {
+            last_error = "Failed to cast wall thickness ray";
+            ERR_PRINT(last_error);
+            return -1.0;
+        }
+
+        // No opposite wall along the direction is not an error
+        const double distance = PackedFloat64Array(hits["distances"])[0];
+        return distance < 0.0 ? -1.0 : distance * unit_scale_factor;
+
+    } catch (const Standard_Failure& e) {
+        last_error = String("OpenCASCADE error measuring wall thickness: ") + e.GetMessageString();
+        ERR_PRINT(last_error);
+    } catch (const std::exception& e) {
+        last_error = String("Standard exception measuring wall thickness: ") + e.what();
+        ERR_PRINT(last_error);
+    } catch (...) {
+        last_error = "Unknown exception measuring wall thickness";
+        ERR_PRINT(last_error);
+    }
+
+    return -1.0;
+}
+
+Dictionary ocgd_measurement_tool::measure_thickness_analysis(const Ref<ocgd_shape>& shape) {
+    ERR_FAIL_NULL_V_MSG(shape.ptr(), Dictionary(), "Shape is null");
+
+    try {
+        TopoDS_Shape occ_shape = shape->get_shape();
+        // Imported meshes have no surfaces for BRepCheck to validate
+        if (validate_inputs && !ocgd_MeshFileParser::is_mesh_only(occ_shape) && !validate_shape(shape)) {
+            return Dictionary();
+        }
+
+        Ref<ocgd_SpatialQuery> query = mesh_query(occ_shape, mesh_deflection(occ_shape, use_high_precision), use_high_precision);
+        if (query.is_null()) {
+            last_error = "Failed to triangulate shape for thickness analysis";
+            ERR_PRINT(last_error);
+            return Dictionary();
+        }
+
+        Dictionary analysis = query->wall_thickness();
+        if (analysis.is_empty()) {
+            last_error = "Failed to measure wall thickness";
+            ERR_PRINT(last_error);
+            return Dictionary();
+        }
+
+        // Thickness values are reported in measurement units; the geometry stays in model units
+        if (unit_scale_factor != 1.0) {
+            PackedFloat64Array thickness = analysis["thickness"];
+            double* thickness_data = thickness.ptrw();
+            for (int64_t i = 0; i < thickness.size(); i++) {
+                if (thickness_data[i] >= 0.0) {
+                    thickness_data[i] *= unit_scale_factor;
+                }
+            }
+            analysis["thickness"] = thickness;
+
+            const char* statistics[] = {"min_thickness", "max_thickness", "mean_thickness"};
+            for (const char* key : statistics) {
+                const double value = analysis[key];
+                if (value >= 0.0) {
+                    analysis[key] = value * unit_scale_factor;
+                }
+            }
+
+            Dictionary percentiles = analysis["percentiles"];
+            Array percentile_keys = percentiles.keys();
+            for (int64_t i = 0; i < percentile_keys.size(); i++) {
+                percentiles[percentile_keys[i]] = double(percentiles[percentile_keys[i]]) * unit_scale_factor;
+            }
+        }
+        analysis["units"] = measurement_units;
+
+        return analysis;
+
+    } catch (const Standard_Failure& e) {
+        last_error = String("OpenCASCADE error in thickness analysis: ") + e.GetMessageString();
+        ERR_PRINT(last_error);
+    } catch (const std::exception& e) {
+        last_error = String("Standard exception in thickness analysis: ") + e.what();
+        ERR_PRINT(last_error);
+    } catch (...) {
+        last_error = "Unknown exception in thickness analysis";
+        ERR_PRINT(last_error);
+    }
+
+    return Dictionary();
+}
+
+double ocgd_measurement_tool::measure_minimum_wall_thickness(const Ref<ocgd_shape>& shape) {
+    Dictionary analysis = measure_thickness_analysis(shape);
+    if (analysis.is_empty()) {
+        return -1.0;
+    }
+    return analysis["min_thickness"];
+}
+
+Array ocgd_measurement_tool::measure_thickness_variations(const Ref<ocgd_shape>& shape, int num_samples) {
+    Array samples;
+    Dictionary analysis = measure_thickness_analysis(shape);
+    if (analysis.is_empty()) {
+        return samples;
+    }
+
+    PackedVector3Array vertices = analysis["vertices"];
+    PackedVector3Array normals = analysis["normals"];
+    PackedFloat64Array thickness = analysis["thickness"];
+    PackedInt32Array face_indices = analysis["face_indices"];
+
+    std::vector<int64_t> measured;
+    measured.reserve(thickness.size());
+    for (int64_t i = 0; i < thickness.size(); i++) {
+        if (thickness[i] >= 0.0) {
+            measured.push_back(i);
+        }
+    }
+
+    // Spread the samples evenly over the measured vertices; 0 or less returns all of them
+    const int64_t count = (num_samples <= 0 || num_samples > static_cast<int64_t>(measured.size()))
+                              ? static_cast<int64_t>(measured.size())
+                              : num_samples;
+    for (int64_t s = 0; s < count; s++) {
+        const int64_t i = measured[s * static_cast<int64_t>(measured.size()) / count];
+        Dictionary sample;
+        sample["point"] = vertices[i];
+        sample["normal"] = normals[i];
+        sample["thickness"] = thickness[i];
+        sample["face_index"] = face_indices[i];
+        samples.push_back(sample);
+    }
+
+    return samples;
+}
+
 Dictionary ocgd_measurement_tool::measure_cross_section_area(const Ref<ocgd_shape>& shape, const Vector3& plane_point, const Vector3& plane_normal) { return Dictionary(); }
 Dictionary ocgd_measurement_tool::measure_cross_section_properties(const Ref<ocgd_shape>& shape, const Vector3& plane_point, const Vector3& plane_normal) { return Dictionary(); }
 double ocgd_measurement_tool::measure_hydraulic_diameter(const Ref<ocgd_shape>& shape, const Vector3& plane_point, const Vector3& plane_normal) { return -1.0; }
@@ -1181,9 +1434,181 @@ double ocgd_measurement_tool::measure_draft_angle(const Ref<ocgd_shape>& shape,
 Dictionary ocgd_measurement_tool::measure_taper_analysis(const Ref<ocgd_shape>& shape, const Vector3& axis_direction) { return Dictionary(); }
 Array ocgd_measurement_tool::measure_undercuts(const Ref<ocgd_shape>& shape, const Vector3& draft_direction) { return Array(); }
 double ocgd_measurement_tool::measure_clearance(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) { return measure_distance_between_shapes(shape1, shape2); }
-Dictionary ocgd_measurement_tool::measure_interference_analysis(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) { return Dictionary(); }
-Array ocgd_measurement_tool::measure_interference_points(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) { return Array(); }
-double ocgd_measurement_tool::measure_penetration_depth(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) { return -1.0; }
+
+Dictionary ocgd_measurement_tool::measure_interference_analysis(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) {
+    ERR_FAIL_NULL_V_MSG(shape1.ptr(), Dictionary(), "Shape1 is null");
+    ERR_FAIL_NULL_V_MSG(shape2.ptr(), Dictionary(), "Shape2 is null");
+
+    try {
+        TopoDS_Shape occ_shape1 = shape1->get_shape();
+        TopoDS_Shape occ_shape2 = shape2->get_shape();
+        const bool mesh_only1 = ocgd_MeshFileParser::is_mesh_only(occ_shape1);
+        const bool mesh_only2 = ocgd_MeshFileParser::is_mesh_only(occ_shape2);
+        if (validate_inputs && ((!mesh_only1 && !validate_shape(shape1)) || (!mesh_only2 && !validate_shape(shape2)))) {
+            return Dictionary();
+        }
+
+        // Both shapes are meshed alike, so the finer part sets the deflection
+        const double deflection = std::min(mesh_deflection(occ_shape1, use_high_precision),
+                                           mesh_deflection(occ_shape2, use_high_precision));
+        Ref<ocgd_SpatialQuery> query1 = mesh_query(occ_shape1, deflection, false);
+        Ref<ocgd_SpatialQuery> query2 = mesh_query(occ_shape2, deflection, false);
+        if (query1.is_null() || query2.is_null()) {
+            last_error = "Failed to triangulate shapes for interference analysis";
+            ERR_PRINT(last_error);
+            return Dictionary();
+        }
+
+        Dictionary analysis = query1->interference(query2);
+        if (analysis.is_empty()) {
+            last_error = "Failed to check interference";
+            ERR_PRINT(last_error);
+            return Dictionary();
+        }
+
+        bool interferes = analysis["interferes"];
+        double overlap_volume = interferes ? -1.0 : 0.0;
+        const PackedInt32Array candidates = analysis["candidate_face_pairs"];
+
+        // The triangulations are accurate to the deflection. A Boolean common of two full parts
+        // costs far more than the broad phase, so the exact overlap volume is opt-in; with it,
+        // high precision mode also decides interference exactly for every candidate face pair.
+        // High precision mode adds exact contact curves of the candidate faces.
+        const bool has_surfaces = !mesh_only1 && !mesh_only2;
+        if (compute_overlap_volume && has_surfaces && (interferes || (use_high_precision && !candidates.is_empty()))) {
+            TopTools_ListOfShape arguments;
+            TopTools_ListOfShape tools;
+            arguments.Append(occ_shape1);
+            tools.Append(occ_shape2);
+
+            BRepAlgoAPI_Common common_op;
+            common_op.SetArguments(arguments);
+            common_op.SetTools(tools);
+            common_op.SetRunParallel(Standard_True);
+            common_op.SetUseOBB(Standard_True);
+            common_op.Build();
+
+            if (common_op.IsDone() && !common_op.Shape().IsNull()) {
+                GProp_GProps properties;
+                BRepGProp::VolumeProperties(common_op.Shape(), properties);
+                overlap_volume = fabs(properties.Mass());
+
+                if (use_high_precision) {
+                    // Slivers thinner than the precision tolerance are contact, not interference
+                    Bnd_Box common_box;
+                    BRepBndLib::Add(common_op.Shape(), common_box);
+                    const double sliver_volume = common_box.IsVoid() ? 0.0 : precision_tolerance * common_box.SquareExtent();
+                    interferes = overlap_volume > sliver_volume;
+                }
+            } else {
+                ERR_PRINT("Exact overlap volume failed, interference is reported from the triangulations only");
+            }
+        }
+
+        if (has_surfaces && use_high_precision && interferes) {
+            // Only faces of candidate pairs are sectioned
+            const ocgd_TriangleBVH& bvh1 = query1->get_bvh();
+            const ocgd_TriangleBVH& bvh2 = query2->get_bvh();
+            std::vector<bool> used1(bvh1.face_count(), false);
+            std::vector<bool> used2(bvh2.face_count(), false);
+            BRep_Builder builder;
+            TopoDS_Compound faces1;
+            TopoDS_Compound faces2;
+            builder.MakeCompound(faces1);
+            builder.MakeCompound(faces2);
+            for (int64_t i = 0; i + 1 < candidates.size(); i += 2) {
+                if (!used1[candidates[i]]) {
+                    used1[candidates[i]] = true;
+                    builder.Add(faces1, bvh1.face(candidates[i]).face);
+                }
+                if (!used2[candidates[i + 1]]) {
+                    used2[candidates[i + 1]] = true;
+                    builder.Add(faces2, bvh2.face(candidates[i + 1]).face);
+                }
+            }
+
+            BRepAlgoAPI_Section section_op(faces1, faces2, Standard_False);
+            section_op.SetRunParallel(Standard_True);
+            section_op.Build();
+
+            Array contact_curves;
+            if (section_op.IsDone()) {
+                for (TopExp_Explorer edge_explorer(section_op.Shape(), TopAbs_EDGE); edge_explorer.More(); edge_explorer.Next()) {
+                    BRepAdaptor_Curve curve(TopoDS::Edge(edge_explorer.Current()));
+                    GCPnts_QuasiUniformDeflection sampler(curve, deflection);
+                    if (!sampler.IsDone()) {
+                        continue;
+                    }
+                    PackedVector3Array points;
+                    for (int i = 1; i <= sampler.NbPoints(); i++) {
+                        const gp_Pnt point = sampler.Value(i);
+                        points.push_back(Vector3(point.X(), point.Y(), point.Z()));
+                    }
+                    contact_curves.push_back(points);
+                }
+            }
+            analysis["contact_curves"] = contact_curves;
+        }
+
+        // Lengths and volumes in measurement units; the geometry stays in model units
+        const double penetration_depth = interferes ? double(analysis["penetration_depth"]) : 0.0;
+        analysis["interferes"] = interferes;
+        analysis["penetration_depth"] = penetration_depth * unit_scale_factor;
+        analysis["overlap_volume"] = overlap_volume < 0.0
+            ? -1.0
+            : overlap_volume * unit_scale_factor * unit_scale_factor * unit_scale_factor;
+        analysis["units"] = measurement_units;
+
+        return analysis;
+
+    } catch (const Standard_Failure& e) {
+        last_error = String("OpenCASCADE error in interference analysis: ") + e.GetMessageString();
+        ERR_PRINT(last_error);
+    } catch (const std::exception& e) {
+        last_error = String("Standard exception in interference analysis: ") + e.what();
+        ERR_PRINT(last_error);
+    } catch (...) {
+        last_error = "Unknown exception in interference analysis";
+        ERR_PRINT(last_error);
+    }
+
+    return Dictionary();
+}
+
+Array ocgd_measurement_tool::measure_interference_points(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) {
+    Array points;
+    Dictionary analysis = measure_interference_analysis(shape1, shape2);
+    if (analysis.is_empty() || !bool(analysis["interferes"])) {
+        return points;
+    }
+
+    // Exact contact curves when available, else the midpoints of the crossing triangle segments
+    if (analysis.has("contact_curves")) {
+        Array contact_curves = analysis["contact_curves"];
+        for (int64_t i = 0; i < contact_curves.size(); i++) {
+            PackedVector3Array curve = contact_curves[i];
+            for (int64_t j = 0; j < curve.size(); j++) {
+                points.push_back(curve[j]);
+            }
+        }
+        return points;
+    }
+
+    PackedVector3Array segments = analysis["contact_segments"];
+    for (int64_t i = 0; i + 1 < segments.size(); i += 2) {
+        points.push_back((segments[i] + segments[i + 1]) * 0.5);
+    }
+    return points;
+}
+
+double ocgd_measurement_tool::measure_penetration_depth(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) {
+    Dictionary analysis = measure_interference_analysis(shape1, shape2);
+    if (analysis.is_empty()) {
+        return -1.0;
+    }
+    return analysis["penetration_depth"];
+}
+
 Dictionary ocgd_measurement_tool::measure_fit_analysis(const Ref<ocgd_shape>& hole_shape, const Ref<ocgd_shape>& shaft_shape) { return Dictionary(); }
 double ocgd_measurement_tool::measure_concentricity_error(const Ref<ocgd_shape>& shape1, const Ref<ocgd_shape>& shape2) { return -1.0; }
 double ocgd_measurement_tool::measure_parallelism_error(const Ref<ocgd_shape>& shape, int face_index1, int face_index2) { return -1.0; }
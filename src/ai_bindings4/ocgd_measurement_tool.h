@@ -8,6 +8,8 @@
 #include <godot_cpp/variant/vector3.hpp>
 #include <godot_cpp/classes/ref.hpp>
 
+#include <memory>
+
 // Forward declarations for OpenCASCADE
 class TopoDS_Shape;
 class TopoDS_Face;
@@ -15,6 +17,7 @@ class TopoDS_Edge;
 class TopoDS_Vertex;
 
 class ocgd_shape;
+class ocgd_SpatialQuery;
 
 class ocgd_measurement_tool : public godot::RefCounted {
     GDCLASS(ocgd_measurement_tool, godot::RefCounted)
@@ -27,6 +30,14 @@ private:
     godot::String measurement_units;
     double unit_scale_factor;
     bool validate_inputs;
+    bool compute_overlap_volume;
+
+    // Spatial queries of recently measured shapes, so that repeated wall thickness and
+    // interference measurements do not triangulate the shape and rebuild its BVH each time
+    struct MeshQueryCache;
+    std::unique_ptr<MeshQueryCache> mesh_query_cache;
+
+    godot::Ref<ocgd_SpatialQuery> mesh_query(const TopoDS_Shape& shape, double deflection, bool refine_to_surface);
 
 protected:
     static void _bind_methods();
@@ -158,6 +169,9 @@ public:
     
     void set_validate_inputs(bool validate);
     bool get_validate_inputs() const;
+
+    void set_compute_overlap_volume(bool compute);
+    bool get_compute_overlap_volume() const;
     
     // Utility and validation methods
     bool validate_shape(const godot::Ref<ocgd_shape>& shape);
@@ -0,0 +1,195 @@
+#include "ocgd_memory_file_system.h"
+#include "../ai_bindings/ocgd_MemoryStream.hxx"
+
+#include <OSD_FileSystem.hxx>
+#include <TCollection_AsciiString.hxx>
+
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using namespace godot;
+
+namespace {
+
+const char MEMORY_PATH_PREFIX[] = "ocgd-memory://";
+
+// Output buffer writing into a shared string; supports seeking so writers can patch headers
+class ocgd_MemoryWriteBuf : public std::streambuf {
+public:
+    ocgd_MemoryWriteBuf(std::shared_ptr<std::string> data, std::size_t position)
+        : _data(std::move(data)), _position(position) {}
+
+protected:
+    std::streamsize xsputn(const char* data, std::streamsize size) override {
+        const std::size_t end = _position + static_cast<std::size_t>(size);
+        if (end > _data->size()) {
+            _data->resize(end);
+        }
+        std::memcpy(&(*_data)[_position], data, static_cast<std::size_t>(size));
+        _position = end;
+        return size;
+    }
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            xsputn(&ch, 1);
+        }
+        return traits_type::not_eof(c);
+    }
+
+    pos_type seekoff(off_type offset, std::ios_base::seekdir direction,
+                     std::ios_base::openmode which = std::ios_base::out) override {
+        if (!(which & std::ios_base::out)) {
+            return pos_type(off_type(-1));
+        }
+
+        off_type base = 0;
+        if (direction == std::ios_base::cur) {
+            base = static_cast<off_type>(_position);
+        } else if (direction == std::ios_base::end) {
+            base = static_cast<off_type>(_data->size());
+        }
+
+        const off_type target = base + offset;
+        if (target < 0) {
+            return pos_type(off_type(-1));
+        }
+        if (static_cast<std::size_t>(target) > _data->size()) {
+            _data->resize(static_cast<std::size_t>(target));
+        }
+        _position = static_cast<std::size_t>(target);
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type position, std::ios_base::openmode which = std::ios_base::out) override {
+        return seekoff(off_type(position), std::ios_base::beg, which);
+    }
+
+private:
+    std::shared_ptr<std::string> _data;
+    std::size_t _position;
+};
+
+// Input buffer reading a shared string in place; keeps the string alive while open
+class ocgd_MemoryReadBuf : public ocgd_MemoryStreamBuf {
+public:
+    explicit ocgd_MemoryReadBuf(const std::shared_ptr<std::string>& data)
+        : ocgd_MemoryStreamBuf(data->data(), data->size()), _data(data) {}
+
+private:
+    std::shared_ptr<std::string> _data;
+};
+
+// OSD_FileSystem protocol serving "ocgd-memory://" paths from memory
+class ocgd_MemoryFileSystem : public OSD_FileSystem {
+public:
+    static const Handle(ocgd_MemoryFileSystem)& instance() {
+        static const Handle(ocgd_MemoryFileSystem) file_system = []() {
+            Handle(ocgd_MemoryFileSystem) created = new ocgd_MemoryFileSystem();
+            // Preferred, so it is asked before the local file system
+            OSD_FileSystem::AddDefaultProtocol(created, true);
+            return created;
+        }();
+        return file_system;
+    }
+
+    std::string create_folder() {
+        return std::string(MEMORY_PATH_PREFIX) + std::to_string(++_folder_counter) + "/";
+    }
+
+    std::shared_ptr<std::string> take(const std::string& path) {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        std::shared_ptr<std::string> data;
+        auto it = _files.find(path);
+        if (it != _files.end()) {
+            data = it->second;
+        }
+
+        // Drop the file and every side file in its folder
+        const std::string folder = path.substr(0, path.rfind('/') + 1);
+        auto first = _files.lower_bound(folder);
+        auto last = first;
+        while (last != _files.end() && last->first.compare(0, folder.size(), folder) == 0) {
+            ++last;
+        }
+        _files.erase(first, last);
+
+        return data;
+    }
+
+    Standard_Boolean IsSupportedPath(const TCollection_AsciiString& theUrl) const override {
+        return std::strncmp(theUrl.ToCString(), MEMORY_PATH_PREFIX, sizeof(MEMORY_PATH_PREFIX) - 1) == 0;
+    }
+
+    Standard_Boolean IsOpenIStream(const std::shared_ptr<std::istream>& theStream) const override {
+        return theStream && dynamic_cast<ocgd_MemoryReadBuf*>(theStream->rdbuf()) != nullptr;
+    }
+
+    Standard_Boolean IsOpenOStream(const std::shared_ptr<std::ostream>& theStream) const override {
+        return theStream && dynamic_cast<ocgd_MemoryWriteBuf*>(theStream->rdbuf()) != nullptr;
+    }
+
+    std::shared_ptr<std::streambuf> OpenStreamBuffer(const TCollection_AsciiString& theUrl,
+                                                     const std::ios_base::openmode theMode,
+                                                     const int64_t theOffset = 0,
+                                                     int64_t* theOutBufSize = NULL) override {
+        const std::string path = theUrl.ToCString();
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if (theMode & std::ios_base::out) {
+            std::shared_ptr<std::string>& data = _files[path];
+            const bool keep = (theMode & std::ios_base::app) || ((theMode & std::ios_base::in) && !(theMode & std::ios_base::trunc));
+            if (!data || !keep) {
+                data = std::make_shared<std::string>();
+            }
+            return std::make_shared<ocgd_MemoryWriteBuf>(data, (theMode & std::ios_base::app) ? data->size() : 0);
+        }
+
+        auto it = _files.find(path);
+        if (it == _files.end()) {
+            return std::shared_ptr<std::streambuf>();
+        }
+
+        const int64_t size = static_cast<int64_t>(it->second->size());
+        if (theOffset < 0 || theOffset > size) {
+            return std::shared_ptr<std::streambuf>();
+        }
+
+        std::shared_ptr<ocgd_MemoryReadBuf> buffer = std::make_shared<ocgd_MemoryReadBuf>(it->second);
+        buffer->pubseekpos(theOffset, std::ios_base::in);
+        if (theOutBufSize != NULL) {
+            *theOutBufSize = size - theOffset;
+        }
+        return buffer;
+    }
+
+    DEFINE_STANDARD_RTTI_INLINE(ocgd_MemoryFileSystem, OSD_FileSystem)
+
+private:
+    std::mutex _mutex;
+    std::map<std::string, std::shared_ptr<std::string>> _files;
+    std::atomic<uint64_t> _folder_counter{0};
+};
+
+} // namespace
+
+String ocgd_memory_file_create_path(const String& file_name) {
+    const std::string folder = ocgd_MemoryFileSystem::instance()->create_folder();
+    return String::utf8(folder.c_str()) + file_name;
+}
+
+PackedByteArray ocgd_memory_file_take(const String& path) {
+    PackedByteArray bytes;
+    const std::shared_ptr<std::string> data = ocgd_MemoryFileSystem::instance()->take(path.utf8().get_data());
+    if (data && !data->empty()) {
+        bytes.resize(static_cast<int64_t>(data->size()));
+        std::memcpy(bytes.ptrw(), data->data(), data->size());
+    }
+    return bytes;
+}
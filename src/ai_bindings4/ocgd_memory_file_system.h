@@ -0,0 +1,21 @@
+#ifndef OCGD_MEMORY_FILE_SYSTEM_H
+#define OCGD_MEMORY_FILE_SYSTEM_H
+
+#include <godot_cpp/variant/string.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+// Internal in-memory file storage for OpenCASCADE writers that only accept a file name.
+//
+// Paths returned by ocgd_memory_file_create_path are served by an OSD_FileSystem protocol
+// registered with OpenCASCADE's default file system, so writers going through
+// OSD_FileSystem (e.g. RWGltf_CafWriter) write into memory instead of to disk. Each path
+// lives in its own private folder, so side files a writer creates next to it (temporary
+// buffers) never collide between concurrent exports.
+
+// Create a unique in-memory path ending in file_name
+godot::String ocgd_memory_file_create_path(const godot::String& file_name);
+
+// Return the content written to path and release it together with all files in its folder
+godot::PackedByteArray ocgd_memory_file_take(const godot::String& path);
+
+#endif // OCGD_MEMORY_FILE_SYSTEM_H
@@ -51,18 +51,140 @@
 #include <Extrema_ExtCC.hxx>
 #include <Extrema_POnCurv.hxx>
 
+#include <memory>
+#include <vector>
+
 using namespace godot;
 
+// Indexed maps of the explored shape, built once per shape so that indexed accessors
+// (get_face_area(i), get_edge_length(i), ...) do not re-walk the whole topology.
+// When caching is disabled the maps are rebuilt on every request instead.
+struct ocgd_topology_explorer::TopologyCache {
+    struct FaceEntry {
+        bool has_area = false;
+        double area = 0.0;
+        bool has_center = false;
+        Vector3 center;
+        bool has_normal = false;
+        Vector3 normal;
+        bool has_type = false;
+        String type;
+    };
+
+    struct EdgeEntry {
+        bool has_length = false;
+        double length = 0.0;
+        bool has_type = false;
+        String type;
+    };
+
+    bool enabled = false;
+    TopoDS_Shape shape;
+    TopTools_IndexedMapOfShape maps[TopAbs_SHAPE];
+    TopTools_IndexedDataMapOfShapeListOfShape edge_face_ancestors;
+    TopTools_IndexedDataMapOfShapeListOfShape vertex_edge_ancestors;
+    std::vector<FaceEntry> faces;
+    std::vector<EdgeEntry> edges;
+
+    void clear() {
+        enabled = false;
+        shape.Nullify();
+        for (int i = 0; i < TopAbs_SHAPE; i++) {
+            maps[i].Clear();
+        }
+        edge_face_ancestors.Clear();
+        vertex_edge_ancestors.Clear();
+        faces.clear();
+        edges.clear();
+    }
+
+    void build(const TopoDS_Shape& new_shape) {
+        clear();
+        shape = new_shape;
+        enabled = true;
+        if (shape.IsNull()) {
+            return;
+        }
+        for (int i = 0; i < TopAbs_SHAPE; i++) {
+            TopExp::MapShapes(shape, static_cast<TopAbs_ShapeEnum>(i), maps[i]);
+        }
+        TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edge_face_ancestors);
+        TopExp::MapShapesAndAncestors(shape, TopAbs_VERTEX, TopAbs_EDGE, vertex_edge_ancestors);
+        faces.resize(maps[TopAbs_FACE].Extent());
+        edges.resize(maps[TopAbs_EDGE].Extent());
+    }
+
+    // Returns the cached map, or fills the caller's storage when caching is disabled,
+    // so that maps held by one caller are never overwritten by the next request
+    const TopTools_IndexedMapOfShape& shape_map(TopAbs_ShapeEnum type, TopTools_IndexedMapOfShape& storage) const {
+        if (enabled) {
+            return maps[type];
+        }
+        if (!shape.IsNull()) {
+            TopExp::MapShapes(shape, type, storage);
+        }
+        return storage;
+    }
+
+    const TopTools_IndexedDataMapOfShapeListOfShape& ancestor_map(TopAbs_ShapeEnum sub_type, TopAbs_ShapeEnum ancestor_type,
+                                                                  TopTools_IndexedDataMapOfShapeListOfShape& storage) const {
+        if (enabled && sub_type == TopAbs_EDGE && ancestor_type == TopAbs_FACE) {
+            return edge_face_ancestors;
+        }
+        if (enabled && sub_type == TopAbs_VERTEX && ancestor_type == TopAbs_EDGE) {
+            return vertex_edge_ancestors;
+        }
+        if (!shape.IsNull()) {
+            TopExp::MapShapesAndAncestors(shape, sub_type, ancestor_type, storage);
+        }
+        return storage;
+    }
+
+    FaceEntry* face_entry(int face_index) {
+        if (!enabled || face_index < 0 || face_index >= static_cast<int>(faces.size())) {
+            return nullptr;
+        }
+        return &faces[face_index];
+    }
+
+    EdgeEntry* edge_entry(int edge_index) {
+        if (!enabled || edge_index < 0 || edge_index >= static_cast<int>(edges.size())) {
+            return nullptr;
+        }
+        return &edges[edge_index];
+    }
+};
+
 ocgd_topology_explorer::ocgd_topology_explorer() {
     precision_tolerance = Precision::Confusion();
     include_orientation_info = true;
-    cache_results = false;
+    cache_results = true;
+    topology_cache = std::make_unique<TopologyCache>();
     last_error = "";
 }
 
 ocgd_topology_explorer::~ocgd_topology_explorer() {
 }
 
+ocgd_topology_explorer::TopologyCache& ocgd_topology_explorer::topology() const {
+    TopologyCache& cache = *topology_cache;
+    TopoDS_Shape shape = has_shape() ? current_shape->get_shape() : TopoDS_Shape();
+
+    if (!cache_results) {
+        if (cache.enabled) {
+            cache.clear();
+        }
+        cache.shape = shape;
+        return cache;
+    }
+
+    // The wrapped ocgd_shape may be modified after set_shape, so rebuild when it no longer matches
+    if (!cache.enabled || !cache.shape.IsEqual(shape)) {
+        cache.build(shape);
+    }
+    return cache;
+}
+
 void ocgd_topology_explorer::_bind_methods() {
     ClassDB::bind_static_method("ocgd_topology_explorer", D_METHOD("new_explorer"), &ocgd_topology_explorer::new_explorer);
     
@@ -140,6 +262,8 @@ void ocgd_topology_explorer::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_precision_tolerance"), &ocgd_topology_explorer::get_precision_tolerance);
     ClassDB::bind_method(D_METHOD("set_include_orientation_info", "include"), &ocgd_topology_explorer::set_include_orientation_info);
     ClassDB::bind_method(D_METHOD("get_include_orientation_info"), &ocgd_topology_explorer::get_include_orientation_info);
+    ClassDB::bind_method(D_METHOD("set_cache_results", "cache"), &ocgd_topology_explorer::set_cache_results);
+    ClassDB::bind_method(D_METHOD("get_cache_results"), &ocgd_topology_explorer::get_cache_results);
     
     // Error handling
     ClassDB::bind_method(D_METHOD("get_last_error"), &ocgd_topology_explorer::get_last_error);
@@ -160,6 +284,10 @@ void ocgd_topology_explorer::set_shape(const Ref<ocgd_shape>& shape) {
     
     try {
         current_shape = shape;
+        topology_cache->clear();
+        if (cache_results) {
+            topology();
+        }
         clear_error();
     } catch (const Standard_Failure& e) {
         last_error = String("OpenCASCADE error in set_shape: ") + e.GetMessageString();
@@ -183,6 +311,7 @@ bool ocgd_topology_explorer::has_shape() const {
 
 void ocgd_topology_explorer::clear_shape() {
     current_shape = Ref<ocgd_shape>();
+    topology_cache->clear();
     clear_error();
 }
 
@@ -194,8 +323,8 @@ Array ocgd_topology_explorer::get_faces() {
         TopoDS_Shape shape = current_shape->get_shape();
         ERR_FAIL_COND_V_MSG(shape.IsNull(), faces, "Shape is null");
         
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             faces.append(i - 1); // Return zero-based indices
@@ -223,8 +352,8 @@ Array ocgd_topology_explorer::get_edges() {
         TopoDS_Shape shape = current_shape->get_shape();
         ERR_FAIL_COND_V_MSG(shape.IsNull(), edges, "Shape is null");
         
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         for (int i = 1; i <= edge_map.Extent(); i++) {
             edges.append(i - 1); // Return zero-based indices
@@ -252,8 +381,8 @@ Array ocgd_topology_explorer::get_vertices() {
         TopoDS_Shape shape = current_shape->get_shape();
         ERR_FAIL_COND_V_MSG(shape.IsNull(), vertices, "Shape is null");
         
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         
         for (int i = 1; i <= vertex_map.Extent(); i++) {
             vertices.append(i - 1); // Return zero-based indices
@@ -281,8 +410,8 @@ Array ocgd_topology_explorer::get_solids() {
         TopoDS_Shape shape = current_shape->get_shape();
         ERR_FAIL_COND_V_MSG(shape.IsNull(), solids, "Shape is null");
         
-        TopTools_IndexedMapOfShape solid_map;
-        TopExp::MapShapes(shape, TopAbs_SOLID, solid_map);
+        TopTools_IndexedMapOfShape solid_map_storage;
+        const TopTools_IndexedMapOfShape& solid_map = topology().shape_map(TopAbs_SOLID, solid_map_storage);
         
         for (int i = 1; i <= solid_map.Extent(); i++) {
             solids.append(i - 1); // Return zero-based indices
@@ -307,9 +436,8 @@ Array ocgd_topology_explorer::get_shells() {
     if (!has_shape()) return shells;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape shell_map;
-        TopExp::MapShapes(shape, TopAbs_SHELL, shell_map);
+        TopTools_IndexedMapOfShape shell_map_storage;
+        const TopTools_IndexedMapOfShape& shell_map = topology().shape_map(TopAbs_SHELL, shell_map_storage);
         
         for (int i = 1; i <= shell_map.Extent(); i++) {
             shells.append(i - 1);
@@ -326,9 +454,8 @@ Array ocgd_topology_explorer::get_wires() {
     if (!has_shape()) return wires;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape wire_map;
-        TopExp::MapShapes(shape, TopAbs_WIRE, wire_map);
+        TopTools_IndexedMapOfShape wire_map_storage;
+        const TopTools_IndexedMapOfShape& wire_map = topology().shape_map(TopAbs_WIRE, wire_map_storage);
         
         for (int i = 1; i <= wire_map.Extent(); i++) {
             wires.append(i - 1);
@@ -345,9 +472,8 @@ Array ocgd_topology_explorer::get_compounds() {
     if (!has_shape()) return compounds;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape compound_map;
-        TopExp::MapShapes(shape, TopAbs_COMPOUND, compound_map);
+        TopTools_IndexedMapOfShape compound_map_storage;
+        const TopTools_IndexedMapOfShape& compound_map = topology().shape_map(TopAbs_COMPOUND, compound_map_storage);
         
         for (int i = 1; i <= compound_map.Extent(); i++) {
             compounds.append(i - 1);
@@ -363,9 +489,8 @@ int ocgd_topology_explorer::get_face_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         return face_map.Extent();
     } catch (...) {
         return 0;
@@ -376,9 +501,8 @@ int ocgd_topology_explorer::get_edge_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         return edge_map.Extent();
     } catch (...) {
         return 0;
@@ -389,9 +513,8 @@ int ocgd_topology_explorer::get_vertex_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         return vertex_map.Extent();
     } catch (...) {
         return 0;
@@ -402,9 +525,8 @@ int ocgd_topology_explorer::get_solid_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape solid_map;
-        TopExp::MapShapes(shape, TopAbs_SOLID, solid_map);
+        TopTools_IndexedMapOfShape solid_map_storage;
+        const TopTools_IndexedMapOfShape& solid_map = topology().shape_map(TopAbs_SOLID, solid_map_storage);
         return solid_map.Extent();
     } catch (...) {
         return 0;
@@ -415,9 +537,8 @@ int ocgd_topology_explorer::get_shell_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape shell_map;
-        TopExp::MapShapes(shape, TopAbs_SHELL, shell_map);
+        TopTools_IndexedMapOfShape shell_map_storage;
+        const TopTools_IndexedMapOfShape& shell_map = topology().shape_map(TopAbs_SHELL, shell_map_storage);
         return shell_map.Extent();
     } catch (...) {
         return 0;
@@ -428,9 +549,8 @@ int ocgd_topology_explorer::get_wire_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape wire_map;
-        TopExp::MapShapes(shape, TopAbs_WIRE, wire_map);
+        TopTools_IndexedMapOfShape wire_map_storage;
+        const TopTools_IndexedMapOfShape& wire_map = topology().shape_map(TopAbs_WIRE, wire_map_storage);
         return wire_map.Extent();
     } catch (...) {
         return 0;
@@ -441,9 +561,8 @@ int ocgd_topology_explorer::get_compound_count() const {
     if (!has_shape()) return 0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape compound_map;
-        TopExp::MapShapes(shape, TopAbs_COMPOUND, compound_map);
+        TopTools_IndexedMapOfShape compound_map_storage;
+        const TopTools_IndexedMapOfShape& compound_map = topology().shape_map(TopAbs_COMPOUND, compound_map_storage);
         return compound_map.Extent();
     } catch (...) {
         return 0;
@@ -458,9 +577,8 @@ Dictionary ocgd_topology_explorer::get_face_properties(int face_index) {
     }
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             last_error = "Face index out of range";
@@ -494,14 +612,18 @@ Vector3 ocgd_topology_explorer::get_face_center(int face_index) {
     if (!has_shape()) return Vector3();
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return Vector3();
         }
         
+        TopologyCache::FaceEntry* cached = topology().face_entry(face_index);
+        if (cached && cached->has_center) {
+            return cached->center;
+        }
+        
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         
         // Calculate center using surface properties
@@ -515,8 +637,13 @@ Vector3 ocgd_topology_explorer::get_face_center(int face_index) {
         double v_mid = (v_min + v_max) / 2.0;
         
         gp_Pnt center_point = surface.Value(u_mid, v_mid);
+        Vector3 center(center_point.X(), center_point.Y(), center_point.Z());
         
-        return Vector3(center_point.X(), center_point.Y(), center_point.Z());
+        if (cached) {
+            cached->center = center;
+            cached->has_center = true;
+        }
+        return center;
         
     } catch (...) {
         return Vector3();
@@ -527,14 +654,18 @@ Vector3 ocgd_topology_explorer::get_face_normal(int face_index) {
     if (!has_shape()) return Vector3();
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return Vector3();
         }
         
+        TopologyCache::FaceEntry* cached = topology().face_entry(face_index);
+        if (cached && cached->has_normal) {
+            return cached->normal;
+        }
+        
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         
         // Calculate normal using surface properties
@@ -554,10 +685,17 @@ Vector3 ocgd_topology_explorer::get_face_normal(int face_index) {
         
         // Calculate normal as cross product of partial derivatives
         gp_Vec normal = du.Crossed(dv);
+        Vector3 result;
         if (normal.Magnitude() > precision_tolerance) {
             normal.Normalize();
-            return Vector3(normal.X(), normal.Y(), normal.Z());
+            result = Vector3(normal.X(), normal.Y(), normal.Z());
+        }
+        
+        if (cached) {
+            cached->normal = result;
+            cached->has_normal = true;
         }
+        return result;
         
     } catch (...) {
         // Fall back to zero vector
@@ -570,18 +708,27 @@ double ocgd_topology_explorer::get_face_area(int face_index) {
     if (!has_shape()) return 0.0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return 0.0;
         }
         
+        TopologyCache::FaceEntry* cached = topology().face_entry(face_index);
+        if (cached && cached->has_area) {
+            return cached->area;
+        }
+        
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         
         GProp_GProps props;
         BRepGProp::SurfaceProperties(face, props);
+        
+        if (cached) {
+            cached->area = props.Mass();
+            cached->has_area = true;
+        }
         return props.Mass();
         
     } catch (...) {
@@ -594,9 +741,8 @@ Dictionary ocgd_topology_explorer::get_face_bounds(int face_index) {
     if (!has_shape()) return bounds;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return bounds;
@@ -633,30 +779,41 @@ String ocgd_topology_explorer::get_face_type(int face_index) {
     if (!has_shape()) return "unknown";
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return "invalid";
         }
         
+        TopologyCache::FaceEntry* cached = topology().face_entry(face_index);
+        if (cached && cached->has_type) {
+            return cached->type;
+        }
+        
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         BRepAdaptor_Surface surface(face);
         
+        String type;
         switch (surface.GetType()) {
-            case GeomAbs_Plane: return "plane";
-            case GeomAbs_Cylinder: return "cylinder";
-            case GeomAbs_Cone: return "cone";
-            case GeomAbs_Sphere: return "sphere";
-            case GeomAbs_Torus: return "torus";
-            case GeomAbs_BezierSurface: return "bezier";
-            case GeomAbs_BSplineSurface: return "bspline";
-            case GeomAbs_SurfaceOfRevolution: return "revolution";
-            case GeomAbs_SurfaceOfExtrusion: return "extrusion";
-            default: return "other";
+            case GeomAbs_Plane: type = "plane"; break;
+            case GeomAbs_Cylinder: type = "cylinder"; break;
+            case GeomAbs_Cone: type = "cone"; break;
+            case GeomAbs_Sphere: type = "sphere"; break;
+            case GeomAbs_Torus: type = "torus"; break;
+            case GeomAbs_BezierSurface: type = "bezier"; break;
+            case GeomAbs_BSplineSurface: type = "bspline"; break;
+            case GeomAbs_SurfaceOfRevolution: type = "revolution"; break;
+            case GeomAbs_SurfaceOfExtrusion: type = "extrusion"; break;
+            default: type = "other"; break;
         }
         
+        if (cached) {
+            cached->type = type;
+            cached->has_type = true;
+        }
+        return type;
+        
     } catch (...) {
         return "error";
     }
@@ -670,9 +827,8 @@ bool ocgd_topology_explorer::is_face_closed(int face_index) {
     if (!has_shape()) return false;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return false;
@@ -699,9 +855,8 @@ double ocgd_topology_explorer::measure_distance_point_to_face(const Vector3& poi
     if (!has_shape()) return -1.0;
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         if (face_index < 0 || face_index >= face_map.Extent()) {
             return -1.0;
@@ -740,7 +895,12 @@ void ocgd_topology_explorer::clear_error() {
 }
 
 void ocgd_topology_explorer::set_precision_tolerance(double tolerance) {
+    if (tolerance == precision_tolerance) {
+        return;
+    }
     precision_tolerance = tolerance;
+    // Cached face normals were computed at the old tolerance
+    topology_cache->clear();
 }
 
 double ocgd_topology_explorer::get_precision_tolerance() const {
@@ -846,9 +1006,8 @@ Dictionary ocgd_topology_explorer::get_edge_properties(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), props, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -882,9 +1041,8 @@ Vector3 ocgd_topology_explorer::get_edge_start_point(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), Vector3(), "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         TopoDS_Vertex first, last;
@@ -911,9 +1069,8 @@ Vector3 ocgd_topology_explorer::get_edge_end_point(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), Vector3(), "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         TopoDS_Vertex first, last;
@@ -940,9 +1097,8 @@ Vector3 ocgd_topology_explorer::get_edge_center(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), Vector3(), "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -973,14 +1129,23 @@ double ocgd_topology_explorer::get_edge_length(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), 0.0, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
+        
+        TopologyCache::EdgeEntry* cached = topology().edge_entry(edge_index);
+        if (cached && cached->has_length) {
+            return cached->length;
+        }
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
         GProp_GProps props;
         BRepGProp::LinearProperties(edge, props);
+        
+        if (cached) {
+            cached->length = props.Mass();
+            cached->has_length = true;
+        }
         return props.Mass();
     } catch (const Standard_Failure& e) {
         last_error = String("OpenCASCADE error getting edge length: ") + e.GetMessageString();
@@ -1001,25 +1166,36 @@ String ocgd_topology_explorer::get_edge_type(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), "unknown", "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
+        
+        TopologyCache::EdgeEntry* cached = topology().edge_entry(edge_index);
+        if (cached && cached->has_type) {
+            return cached->type;
+        }
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         BRepAdaptor_Curve curve(edge);
         
+        String type;
         switch (curve.GetType()) {
-            case GeomAbs_Line: return "line";
-            case GeomAbs_Circle: return "circle";
-            case GeomAbs_Ellipse: return "ellipse";
-            case GeomAbs_Hyperbola: return "hyperbola";
-            case GeomAbs_Parabola: return "parabola";
-            case GeomAbs_BezierCurve: return "bezier";
-            case GeomAbs_BSplineCurve: return "bspline";
-            case GeomAbs_OffsetCurve: return "offset";
-            case GeomAbs_OtherCurve: return "other";
-            default: return "unknown";
-        }
+            case GeomAbs_Line: type = "line"; break;
+            case GeomAbs_Circle: type = "circle"; break;
+            case GeomAbs_Ellipse: type = "ellipse"; break;
+            case GeomAbs_Hyperbola: type = "hyperbola"; break;
+            case GeomAbs_Parabola: type = "parabola"; break;
+            case GeomAbs_BezierCurve: type = "bezier"; break;
+            case GeomAbs_BSplineCurve: type = "bspline"; break;
+            case GeomAbs_OffsetCurve: type = "offset"; break;
+            case GeomAbs_OtherCurve: type = "other"; break;
+            default: type = "unknown"; break;
+        }
+        
+        if (cached) {
+            cached->type = type;
+            cached->has_type = true;
+        }
+        return type;
     } catch (const Standard_Failure& e) {
         last_error = String("OpenCASCADE error getting edge type: ") + e.GetMessageString();
         ERR_PRINT(last_error);
@@ -1043,9 +1219,8 @@ bool ocgd_topology_explorer::is_edge_closed(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), false, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         return BRep_Tool::IsClosed(edge);
@@ -1069,9 +1244,8 @@ Dictionary ocgd_topology_explorer::get_vertex_properties(int vertex_index) {
     ERR_FAIL_INDEX_V_MSG(vertex_index, get_vertex_count(), props, "Vertex index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         
         TopoDS_Vertex vertex = TopoDS::Vertex(vertex_map(vertex_index + 1));
         
@@ -1099,9 +1273,8 @@ Vector3 ocgd_topology_explorer::get_vertex_position(int vertex_index) {
     ERR_FAIL_INDEX_V_MSG(vertex_index, get_vertex_count(), Vector3(), "Vertex index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         
         TopoDS_Vertex vertex = TopoDS::Vertex(vertex_map(vertex_index + 1));
         gp_Pnt point = BRep_Tool::Pnt(vertex);
@@ -1126,9 +1299,8 @@ double ocgd_topology_explorer::measure_distance_point_to_edge(const Vector3& poi
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), -1.0, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         gp_Pnt query_point(point.x, point.y, point.z);
@@ -1162,9 +1334,8 @@ double ocgd_topology_explorer::measure_distance_face_to_face(int face_index1, in
     ERR_FAIL_INDEX_V_MSG(face_index2, get_face_count(), -1.0, "Face index 2 out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face1 = TopoDS::Face(face_map(face_index1 + 1));
         TopoDS_Face face2 = TopoDS::Face(face_map(face_index2 + 1));
@@ -1197,9 +1368,8 @@ double ocgd_topology_explorer::measure_distance_edge_to_edge(int edge_index1, in
     ERR_FAIL_INDEX_V_MSG(edge_index2, get_edge_count(), -1.0, "Edge index 2 out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge1 = TopoDS::Edge(edge_map(edge_index1 + 1));
         TopoDS_Edge edge2 = TopoDS::Edge(edge_map(edge_index2 + 1));
@@ -1358,17 +1528,16 @@ Array ocgd_topology_explorer::get_faces_of_solid(int solid_index) {
     ERR_FAIL_INDEX_V_MSG(solid_index, get_solid_count(), faces, "Solid index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape solid_map;
-        TopExp::MapShapes(shape, TopAbs_SOLID, solid_map);
+        TopTools_IndexedMapOfShape solid_map_storage;
+        const TopTools_IndexedMapOfShape& solid_map = topology().shape_map(TopAbs_SOLID, solid_map_storage);
         
         TopoDS_Solid solid = TopoDS::Solid(solid_map(solid_index + 1));
         TopTools_IndexedMapOfShape face_map;
         TopExp::MapShapes(solid, TopAbs_FACE, face_map);
         
         // Map back to global face indices
-        TopTools_IndexedMapOfShape global_face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, global_face_map);
+        TopTools_IndexedMapOfShape global_face_map_storage;
+        const TopTools_IndexedMapOfShape& global_face_map = topology().shape_map(TopAbs_FACE, global_face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             TopoDS_Face face = TopoDS::Face(face_map(i));
@@ -1398,17 +1567,16 @@ Array ocgd_topology_explorer::get_edges_of_face(int face_index) {
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), edges, "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         TopTools_IndexedMapOfShape edge_map;
         TopExp::MapShapes(face, TopAbs_EDGE, edge_map);
         
         // Map back to global edge indices
-        TopTools_IndexedMapOfShape global_edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, global_edge_map);
+        TopTools_IndexedMapOfShape global_edge_map_storage;
+        const TopTools_IndexedMapOfShape& global_edge_map = topology().shape_map(TopAbs_EDGE, global_edge_map_storage);
         
         for (int i = 1; i <= edge_map.Extent(); i++) {
             TopoDS_Edge edge = TopoDS::Edge(edge_map(i));
@@ -1438,17 +1606,16 @@ Array ocgd_topology_explorer::get_vertices_of_edge(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), vertices, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         TopTools_IndexedMapOfShape vertex_map;
         TopExp::MapShapes(edge, TopAbs_VERTEX, vertex_map);
         
         // Map back to global vertex indices
-        TopTools_IndexedMapOfShape global_vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, global_vertex_map);
+        TopTools_IndexedMapOfShape global_vertex_map_storage;
+        const TopTools_IndexedMapOfShape& global_vertex_map = topology().shape_map(TopAbs_VERTEX, global_vertex_map_storage);
         
         for (int i = 1; i <= vertex_map.Extent(); i++) {
             TopoDS_Vertex vertex = TopoDS::Vertex(vertex_map(i));
@@ -1478,20 +1645,19 @@ Array ocgd_topology_explorer::get_edges_of_vertex(int vertex_index) {
     ERR_FAIL_INDEX_V_MSG(vertex_index, get_vertex_count(), edges, "Vertex index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         
         TopoDS_Vertex vertex = TopoDS::Vertex(vertex_map(vertex_index + 1));
         
         // Build adjacency map
-        TopTools_IndexedDataMapOfShapeListOfShape vertex_edge_map;
-        TopExp::MapShapesAndAncestors(shape, TopAbs_VERTEX, TopAbs_EDGE, vertex_edge_map);
+        TopTools_IndexedDataMapOfShapeListOfShape vertex_edge_map_storage;
+        const TopTools_IndexedDataMapOfShapeListOfShape& vertex_edge_map = topology().ancestor_map(TopAbs_VERTEX, TopAbs_EDGE, vertex_edge_map_storage);
         
         if (vertex_edge_map.Contains(vertex)) {
             const TopTools_ListOfShape& edge_list = vertex_edge_map.FindFromKey(vertex);
-            TopTools_IndexedMapOfShape global_edge_map;
-            TopExp::MapShapes(shape, TopAbs_EDGE, global_edge_map);
+            TopTools_IndexedMapOfShape global_edge_map_storage;
+            const TopTools_IndexedMapOfShape& global_edge_map = topology().shape_map(TopAbs_EDGE, global_edge_map_storage);
             
             for (TopTools_ListIteratorOfListOfShape it(edge_list); it.More(); it.Next()) {
                 TopoDS_Edge edge = TopoDS::Edge(it.Value());
@@ -1521,15 +1687,14 @@ Array ocgd_topology_explorer::get_adjacent_faces(int face_index) {
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), adjacent_faces, "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         
         // Build face-edge adjacency map
-        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map;
-        TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edge_face_map);
+        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map_storage;
+        const TopTools_IndexedDataMapOfShapeListOfShape& edge_face_map = topology().ancestor_map(TopAbs_EDGE, TopAbs_FACE, edge_face_map_storage);
         
         // Get edges of this face
         TopTools_IndexedMapOfShape edge_map;
@@ -1572,9 +1737,8 @@ Array ocgd_topology_explorer::get_connected_edges(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), connected_edges, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -1583,8 +1747,8 @@ Array ocgd_topology_explorer::get_connected_edges(int edge_index) {
         TopExp::MapShapes(edge, TopAbs_VERTEX, vertex_map);
         
         // Build vertex-edge adjacency map
-        TopTools_IndexedDataMapOfShapeListOfShape vertex_edge_map;
-        TopExp::MapShapesAndAncestors(shape, TopAbs_VERTEX, TopAbs_EDGE, vertex_edge_map);
+        TopTools_IndexedDataMapOfShapeListOfShape vertex_edge_map_storage;
+        const TopTools_IndexedDataMapOfShapeListOfShape& vertex_edge_map = topology().ancestor_map(TopAbs_VERTEX, TopAbs_EDGE, vertex_edge_map_storage);
         
         // For each vertex, find connected edges
         for (int i = 1; i <= vertex_map.Extent(); i++) {
@@ -1623,9 +1787,8 @@ Dictionary ocgd_topology_explorer::get_edge_bounds(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), bounds, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -1663,9 +1826,8 @@ double ocgd_topology_explorer::get_edge_curvature_at_param(int edge_index, doubl
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), 0.0, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -1701,9 +1863,8 @@ double ocgd_topology_explorer::get_vertex_tolerance(int vertex_index) {
     ERR_FAIL_INDEX_V_MSG(vertex_index, get_vertex_count(), 0.0, "Vertex index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape vertex_map;
-        TopExp::MapShapes(shape, TopAbs_VERTEX, vertex_map);
+        TopTools_IndexedMapOfShape vertex_map_storage;
+        const TopTools_IndexedMapOfShape& vertex_map = topology().shape_map(TopAbs_VERTEX, vertex_map_storage);
         
         TopoDS_Vertex vertex = TopoDS::Vertex(vertex_map(vertex_index + 1));
         return BRep_Tool::Tolerance(vertex);
@@ -1728,9 +1889,8 @@ Dictionary ocgd_topology_explorer::get_closest_points_face_to_face(int face_inde
     ERR_FAIL_INDEX_V_MSG(face_index2, get_face_count(), result, "Face index 2 out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face1 = TopoDS::Face(face_map(face_index1 + 1));
         TopoDS_Face face2 = TopoDS::Face(face_map(face_index2 + 1));
@@ -1771,9 +1931,8 @@ Dictionary ocgd_topology_explorer::get_closest_points_edge_to_edge(int edge_inde
     ERR_FAIL_INDEX_V_MSG(edge_index2, get_edge_count(), result, "Edge index 2 out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge1 = TopoDS::Edge(edge_map(edge_index1 + 1));
         TopoDS_Edge edge2 = TopoDS::Edge(edge_map(edge_index2 + 1));
@@ -1812,9 +1971,8 @@ Vector3 ocgd_topology_explorer::get_closest_point_on_face(const Vector3& point,
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), Vector3(), "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         gp_Pnt query_point(point.x, point.y, point.z);
@@ -1849,9 +2007,8 @@ Vector3 ocgd_topology_explorer::get_closest_point_on_edge(const Vector3& point,
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), Vector3(), "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         gp_Pnt query_point(point.x, point.y, point.z);
@@ -1885,11 +2042,10 @@ bool ocgd_topology_explorer::is_shape_manifold() {
     ERR_FAIL_COND_V_MSG(!has_shape(), false, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
         
         // Build edge-face adjacency map
-        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map;
-        TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edge_face_map);
+        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map_storage;
+        const TopTools_IndexedDataMapOfShapeListOfShape& edge_face_map = topology().ancestor_map(TopAbs_EDGE, TopAbs_FACE, edge_face_map_storage);
         
         // Check that each edge is shared by exactly 2 faces (manifold condition)
         for (int i = 1; i <= edge_face_map.Extent(); i++) {
@@ -1920,14 +2076,13 @@ Array ocgd_topology_explorer::find_free_edges() {
     ERR_FAIL_COND_V_MSG(!has_shape(), free_edges, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
         
         // Build edge-face adjacency map
-        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map;
-        TopExp::MapShapesAndAncestors(shape, TopAbs_EDGE, TopAbs_FACE, edge_face_map);
+        TopTools_IndexedDataMapOfShapeListOfShape edge_face_map_storage;
+        const TopTools_IndexedDataMapOfShapeListOfShape& edge_face_map = topology().ancestor_map(TopAbs_EDGE, TopAbs_FACE, edge_face_map_storage);
         
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         // Find edges that belong to only one face (free edges)
         for (int i = 1; i <= edge_map.Extent(); i++) {
@@ -1960,9 +2115,8 @@ Array ocgd_topology_explorer::find_degenerate_faces() {
     ERR_FAIL_COND_V_MSG(!has_shape(), degenerate_faces, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             TopoDS_Face face = TopoDS::Face(face_map(i));
@@ -1998,11 +2152,10 @@ Array ocgd_topology_explorer::find_small_features(double min_size) {
     ERR_FAIL_COND_V_MSG(min_size <= 0.0, small_features, "Minimum size must be positive");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
         
         // Check faces
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             TopoDS_Face face = TopoDS::Face(face_map(i));
@@ -2020,8 +2173,8 @@ Array ocgd_topology_explorer::find_small_features(double min_size) {
         }
         
         // Check edges
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         for (int i = 1; i <= edge_map.Extent(); i++) {
             TopoDS_Edge edge = TopoDS::Edge(edge_map(i));
@@ -2060,9 +2213,8 @@ Dictionary ocgd_topology_explorer::get_face_curvature_at_uv(int face_index, doub
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), curvature, "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         BRepAdaptor_Surface surface(face);
@@ -2135,9 +2287,8 @@ Dictionary ocgd_topology_explorer::get_edge_curvature_analysis(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), analysis, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         BRepAdaptor_Curve curve(edge);
@@ -2199,9 +2350,8 @@ Dictionary ocgd_topology_explorer::get_face_uv_bounds(int face_index) {
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), bounds, "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         BRepAdaptor_Surface surface(face);
@@ -2244,9 +2394,8 @@ Vector3 ocgd_topology_explorer::evaluate_face_at_uv(int face_index, double u, do
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), Vector3(), "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         BRepAdaptor_Surface surface(face);
@@ -2279,9 +2428,8 @@ Dictionary ocgd_topology_explorer::get_face_derivatives_at_uv(int face_index, do
     ERR_FAIL_INDEX_V_MSG(face_index, get_face_count(), derivatives, "Face index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face = TopoDS::Face(face_map(face_index + 1));
         BRepAdaptor_Surface surface(face);
@@ -2348,8 +2496,8 @@ Array ocgd_topology_explorer::find_face_intersections(int face_index1, int face_
     
     try {
         // Get the faces using the existing mapping
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(current_shape->get_shape(), TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         TopoDS_Face face1 = TopoDS::Face(face_map(face_index1 + 1));
         TopoDS_Face face2 = TopoDS::Face(face_map(face_index2 + 1));
@@ -2398,8 +2546,8 @@ Array ocgd_topology_explorer::find_edge_intersections(int edge_index1, int edge_
     
     try {
         // Get the edges using the existing mapping
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(current_shape->get_shape(), TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge1 = TopoDS::Edge(edge_map(edge_index1 + 1));
         TopoDS_Edge edge2 = TopoDS::Edge(edge_map(edge_index2 + 1));
@@ -2470,9 +2618,8 @@ Dictionary ocgd_topology_explorer::get_edge_bounding_box(int edge_index) {
     ERR_FAIL_INDEX_V_MSG(edge_index, get_edge_count(), bounds, "Edge index out of range");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape edge_map;
-        TopExp::MapShapes(shape, TopAbs_EDGE, edge_map);
+        TopTools_IndexedMapOfShape edge_map_storage;
+        const TopTools_IndexedMapOfShape& edge_map = topology().shape_map(TopAbs_EDGE, edge_map_storage);
         
         TopoDS_Edge edge = TopoDS::Edge(edge_map(edge_index + 1));
         
@@ -2553,9 +2700,8 @@ Array ocgd_topology_explorer::find_holes() {
     ERR_FAIL_COND_V_MSG(!has_shape(), holes, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             TopoDS_Face face = TopoDS::Face(face_map(i));
@@ -2601,9 +2747,8 @@ Array ocgd_topology_explorer::find_fillets() {
     ERR_FAIL_COND_V_MSG(!has_shape(), fillets, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             TopoDS_Face face = TopoDS::Face(face_map(i));
@@ -2651,9 +2796,8 @@ Array ocgd_topology_explorer::find_chamfers() {
     ERR_FAIL_COND_V_MSG(!has_shape(), chamfers, "No shape set for topology exploration");
     
     try {
-        TopoDS_Shape shape = current_shape->get_shape();
-        TopTools_IndexedMapOfShape face_map;
-        TopExp::MapShapes(shape, TopAbs_FACE, face_map);
+        TopTools_IndexedMapOfShape face_map_storage;
+        const TopTools_IndexedMapOfShape& face_map = topology().shape_map(TopAbs_FACE, face_map_storage);
         
         for (int i = 1; i <= face_map.Extent(); i++) {
             String face_type = get_face_type(i - 1);
@@ -2769,6 +2913,7 @@ Array ocgd_topology_explorer::find_conical_faces() {
 // Analysis and export methods
 void ocgd_topology_explorer::set_cache_results(bool cache) { 
     cache_results = cache; 
+    topology_cache->clear();
 }
 
 bool ocgd_topology_explorer::get_cache_results() const { 
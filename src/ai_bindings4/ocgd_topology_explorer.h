@@ -8,6 +8,8 @@
 #include <godot_cpp/variant/vector3.hpp>
 #include <godot_cpp/classes/ref.hpp>
 
+#include <memory>
+
 // Forward declarations for OpenCASCADE
 class TopoDS_Shape;
 class TopoDS_Face;
@@ -20,11 +22,18 @@ class ocgd_topology_explorer : public godot::RefCounted {
     GDCLASS(ocgd_topology_explorer, godot::RefCounted)
 
 private:
+    // Indexed sub-shape maps, ancestor maps and per-entity property caches (defined in the .cpp)
+    struct TopologyCache;
+
     godot::String last_error;
     godot::Ref<ocgd_shape> current_shape;
     double precision_tolerance;
     bool include_orientation_info;
     bool cache_results;
+    std::unique_ptr<TopologyCache> topology_cache;
+
+    // Returns the topology cache for the current shape, rebuilding it if the shape changed
+    TopologyCache& topology() const;
 
 protected:
     static void _bind_methods();
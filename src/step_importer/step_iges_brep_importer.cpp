@@ -16,6 +16,8 @@
 #include <godot_cpp/classes/resource_saver.hpp>
 #include <godot_cpp/classes/array_mesh.hpp>
 
+#include "../ai_bindings/ocgd_ArrayMeshBuilder.hxx"
+
 StepIgesBRepImporter::StepIgesBRepImporter() = default;
 
 StepIgesBRepImporter::~StepIgesBRepImporter() = default;
@@ -23,6 +25,32 @@ StepIgesBRepImporter::~StepIgesBRepImporter() = default;
 void StepIgesBRepImporter::_bind_methods()
 {
     ClassDB::bind_method(D_METHOD("import", "String"), &StepIgesBRepImporter::import);
+    ClassDB::bind_method(D_METHOD("set_worker_count", "worker_count"), &StepIgesBRepImporter::set_worker_count);
+    ClassDB::bind_method(D_METHOD("get_worker_count"), &StepIgesBRepImporter::get_worker_count);
+    ClassDB::bind_method(D_METHOD("set_lod_count", "lod_count"), &StepIgesBRepImporter::set_lod_count);
+    ClassDB::bind_method(D_METHOD("get_lod_count"), &StepIgesBRepImporter::get_lod_count);
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "worker_count"), "set_worker_count", "get_worker_count");
+    ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_count"), "set_lod_count", "get_lod_count");
+}
+
+void StepIgesBRepImporter::set_worker_count(int p_worker_count)
+{
+    worker_count = p_worker_count;
+}
+
+int StepIgesBRepImporter::get_worker_count() const
+{
+    return worker_count;
+}
+
+void StepIgesBRepImporter::set_lod_count(int p_lod_count)
+{
+    lod_count = p_lod_count;
+}
+
+int StepIgesBRepImporter::get_lod_count() const
+{
+    return lod_count;
 }
 
 
@@ -77,57 +105,20 @@ Error StepIgesBRepImporter::import(const String& p_source_file) const
         return ERR_UNAVAILABLE;
     }
 
-    double linear_deflection = 0.01;
-    double angular_deflection = 0.1;
-    BRepMesh_IncrementalMesh mesher(shape, linear_deflection, false, angular_deflection, true);
-
-    Ref<ArrayMesh> mesh;
-    mesh.instantiate();
-
-    for (TopExp_Explorer faceExp(shape, TopAbs_FACE); faceExp.More(); faceExp.Next())
+    // Triangulate and write one surface with normals and indices in a single native pass
+    Ref<ocgd_ArrayMeshBuilder> builder;
+    builder.instantiate();
+    builder->set_linear_deflection(0.01);
+    builder->set_angular_deflection(0.1);
+    builder->set_worker_count(worker_count);
+    builder->set_parallel_processing(worker_count != 1);
+    builder->set_lod_count(lod_count);
+
+    Ref<ArrayMesh> mesh = builder->build_occt_shape(shape);
+    if (mesh.is_null())
     {
-        TopoDS_Face face = TopoDS::Face(faceExp.Current());
-        TopLoc_Location the_location;
-        // Grab the location of the mesh/face?
-        face.Location(the_location);
-        Handle(Poly_Triangulation) triangulation = BRep_Tool::Triangulation(face, the_location);
-
-        if (triangulation.IsNull())
-            continue;
-
-        PackedVector3Array vertices;
-        PackedInt32Array indices;
-
-        for (int i = 1; i <= triangulation->NbNodes(); ++i)
-        {
-            gp_Pnt p = triangulation->Node(i);
-            vertices.push_back(Vector3(p.X(), p.Y(), p.Z()));
-        }
-
-        for (int i = 1; i <= triangulation->NbTriangles(); ++i)
-        {
-            int n1, n2, n3;
-            triangulation->Triangle(i).Get(n1, n2, n3);
-            if (face.Orientation() != TopAbs_REVERSED)
-            {
-                indices.push_back(n1 - 1);
-                indices.push_back(n2 - 1);
-                indices.push_back(n3 - 1);
-            }
-            else
-            {
-                indices.push_back(n3 - 1);
-                indices.push_back(n2 - 1);
-                indices.push_back(n1 - 1);
-            }
-        }
-
-        Array arrays;
-        arrays.resize(Mesh::ARRAY_MAX);
-        arrays[Mesh::ARRAY_VERTEX] = vertices;
-        arrays[Mesh::ARRAY_INDEX] = indices;
-
-        mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+        ERR_PRINT("Failed to build mesh from shape.");
+        return ERR_CANT_CREATE;
     }
 
     String save_path_with_ext = p_source_file.get_base_dir() + "/" + p_source_file.get_file().get_basename() + ".res";
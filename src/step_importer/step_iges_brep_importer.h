@@ -10,6 +10,12 @@ class StepIgesBRepImporter final : public RefCounted
 {
     GDCLASS(StepIgesBRepImporter, RefCounted)
 
+    // Number of threads used to mesh and extract faces (0 = one per core, 1 = serial)
+    int worker_count = 0;
+
+    // Number of coarser LOD levels added to the mesh (0 = none)
+    int lod_count = 0;
+
 protected:
     static void _bind_methods();
 
@@ -18,5 +24,13 @@ public:
 
     ~StepIgesBRepImporter() override;
 
+    void set_worker_count(int p_worker_count);
+
+    int get_worker_count() const;
+
+    void set_lod_count(int p_lod_count);
+
+    int get_lod_count() const;
+
     Error import(const String& p_source_file) const;
 };